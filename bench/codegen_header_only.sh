@@ -0,0 +1,72 @@
+#!/bin/bash
+
+# --------------------------------------------
+# Header-only keyword call vs. direct argument
+# --------------------------------------------
+#
+# Compiles a function taking kw::BorderSize = 10 through a const ckw &, and the same function taking the int
+# directly, at -O2 with keyword_header_only defined, and compares the generated code of the two callers.  With
+# FillKeyValues() visible to the optimizer, the single keyword call should fold to the same code as the direct
+# argument.  The same source compiled without keyword_header_only is shown for contrast (FillKeyValues() is
+# an out-of-line call there).
+#
+# A two-keyword streamed list is reported too, for information only: the keyword list walk is not unrolled,
+# so it does not fold to a constant (the instruction count is printed, but does not affect the exit status).
+#
+# This is a standalone script (the repo has no build system) -- run it from anywhere:
+#
+#       bench/codegen_header_only.sh            (uses g++, or $CXX)
+#
+# Exit status is 0 when the single keyword code matches.
+
+CXX=${CXX:-g++}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/headeronly.cpp" <<'EOF'
+#include "my_keywords.h"
+
+using namespace ckwargs;
+
+static inline __forceinline int Draw(int x,const ckw & kwx)
+{
+    auto keys = kwx.FillKeyValues();
+    return ckw::Get(keys.AddBorder,true) ? x + ckw::Get(keys.BorderSize,1) : x;
+}
+
+static int DrawDirect(int x,bool bAddBorder,int iBorderSize) { return bAddBorder ? x + iBorderSize : x; }
+
+extern "C" int ByArgument(int x)    { return DrawDirect(x,true,10); }
+extern "C" int ByKeyword(int x)     { return Draw(x,kw::BorderSize = 10); }
+extern "C" int ByKeywordList(int x) { return Draw(x,(kw::BorderSize = 10, kw::AddBorder = true)); }
+EOF
+
+"$CXX" -std=c++17 -O2 -Dkeyword_header_only -I"$ROOT/include" -c "$TMP/headeronly.cpp" -o "$TMP/inline.o" || exit 2
+"$CXX" -std=c++17 -O2                        -I"$ROOT/include" -c "$TMP/headeronly.cpp" -o "$TMP/library.o" || exit 2
+
+# Instructions of one function, without addresses, padding or relocation comments
+
+Disasm()
+{
+    objdump -d --no-show-raw-insn "$1" | sed -n "/<$2>:/,/^\$/p" | tail -n +2 \
+        | sed -e 's/^ *[0-9a-f]*:[[:space:]]*//' -e 's/#.*//' -e 's/[[:space:]]*$//' | grep -v -e '^$' -e 'nop'
+}
+
+Disasm "$TMP/inline.o"  ByArgument    > "$TMP/argument.s"
+Disasm "$TMP/inline.o"  ByKeyword     > "$TMP/keyword.s"
+Disasm "$TMP/library.o" ByKeyword     > "$TMP/library.s"
+Disasm "$TMP/inline.o"  ByKeywordList > "$TMP/list.s"
+
+echo "--- direct argument ($(wc -l < "$TMP/argument.s") instructions)"
+cat "$TMP/argument.s"
+echo "--- kw::BorderSize = 10, keyword_header_only ($(wc -l < "$TMP/keyword.s") instructions)"
+cat "$TMP/keyword.s"
+echo "--- kw::BorderSize = 10, library build: $(wc -l < "$TMP/library.s") instructions"
+echo "--- kw::BorderSize = 10, kw::AddBorder = true, keyword_header_only: $(wc -l < "$TMP/list.s") instructions"
+
+if diff -q "$TMP/argument.s" "$TMP/keyword.s" > /dev/null; then
+    echo "match"
+else
+    echo "differs"; exit 1
+fi
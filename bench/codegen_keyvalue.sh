@@ -0,0 +1,58 @@
+#!/bin/bash
+
+# ---------------------------------------------------
+# Keyword value construction vs. hand-written stores
+# ---------------------------------------------------
+#
+# Compiles kf::Range(5,10) constructed into a ckwkey, and the same header and value stores written by hand,
+# at -O2, and compares the generated code of the two functions.  The keyword function should compile to the
+# same stores, with no calls (i.e. no std::function, type erasure or allocation).
+#
+# This is a standalone script (the repo has no build system) -- run it from anywhere:
+#
+#       bench/codegen_keyvalue.sh               (uses g++, or $CXX)
+#
+# Exit status is 0 when the code matches.
+
+CXX=${CXX:-g++}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+cat > "$TMP/keyvalue.cpp" <<'EOF'
+#include <new>
+#include "my_keyfuncs.h"
+
+using namespace ckwargs;
+
+// Same layout as ckwkey<Keywords::Range> -- ckw header, then the value
+
+struct Hand { const void * pNext; int key; unsigned reserved; std::array<int,2> value; };
+
+extern "C" void ByHand(Hand * p)     { p->pNext = nullptr; p->key = (int) Keywords::Range; p->reserved = 0; p->value = {{ 5, 10 }}; }
+extern "C" void ByKeyword(void * p)  { new (p) ckwkey<Keywords::Range>(kf::Range(5,10)); }
+EOF
+
+"$CXX" -std=c++17 -O2 -I"$ROOT/include" -c "$TMP/keyvalue.cpp" -o "$TMP/keyvalue.o" || exit 2
+
+# Instructions of one function, without addresses, padding or relocation comments
+
+Disasm()
+{
+    objdump -d --no-show-raw-insn "$TMP/keyvalue.o" | sed -n "/<$1>:/,/^\$/p" | tail -n +2 \
+        | sed -e 's/^ *[0-9a-f]*:[[:space:]]*//' -e 's/#.*//' -e 's/[[:space:]]*$//' | grep -v -e '^$' -e '^nop'
+}
+
+Disasm ByHand    > "$TMP/hand.s"
+Disasm ByKeyword > "$TMP/keyword.s"
+
+echo "--- hand-written ($(wc -l < "$TMP/hand.s") instructions)"
+cat "$TMP/hand.s"
+echo "--- kf::Range(5,10) ($(wc -l < "$TMP/keyword.s") instructions)"
+cat "$TMP/keyword.s"
+
+if diff -q "$TMP/hand.s" "$TMP/keyword.s" > /dev/null; then
+    echo "match"
+else
+    echo "differs"; exit 1
+fi
@@ -0,0 +1,87 @@
+#!/bin/bash
+
+# ---------------------------------------------------------
+# Compile time of pkw call sites -- fold vs. recursive fill
+# ---------------------------------------------------------
+#
+# Generates 10, 100 and 1000 call sites of a parameter-pack keyword function, each with 1-8 keywords picked in a
+# random (but repeatable) order and combination, and times the compile of each file at -O2 twice: with the C++17
+# fold expression fill, and with the recursive fill used in C++11 mode (keyword_cpp17_support commented out in a
+# temporary copy of include/).  Both builds use the same -std, so the only difference is pkw::__fillkeyvalues.
+#
+# This is a standalone script (the repo has no build system) -- run it from anywhere:
+#
+#       bench/compile_time.sh                   (uses g++, or $CXX)
+#       bench/compile_time.sh 10 100            (only the given call site counts)
+#
+# Each file is compiled three times per mode and the fastest time is shown, with the object size.  SomeFunction()
+# is noinline, so the object keeps one instance per distinct keyword signature.  The first row (0 call sites) is
+# the cost of the headers alone, which differs between the modes (C++17 mode also includes <memory_resource> and
+# <optional>) -- compare the growth from that row, not the absolute times.
+
+CXX=${CXX:-g++}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+COUNTS="0 ${*:-10 100 1000}"
+
+# Recursive (C++11 mode) copy of the headers
+
+cp -r "$ROOT/include" "$TMP/recursive"
+sed -i 's|^#define keyword_cpp17_support|//#define keyword_cpp17_support|' "$TMP/recursive/ckwargs.h"
+
+# Generate a file with $1 call sites (srand() is seeded with the count, so each file is the same on every run)
+
+Generate()
+{
+    awk -v count="$1" 'BEGIN {
+        srand(count)
+        split("kw::Range = {1,2}|kw::Text = \"a\"|kw::BorderSize = 1|kw::AddBorder = true", keys, "|")
+
+        print "#include \"my_keywords.h\""
+        print ""
+        print "using namespace ckwargs;"
+        print ""
+        print "template <class... Args>"
+        print "__attribute__((noinline)) int SomeFunction(const Args&... kwArgs)"
+        print "{"
+        print "    auto keys = pkw::FillKeyValues(kwArgs...);"
+        print "    return ckw::Get(keys.BorderSize,0) + (ckw::Get(keys.AddBorder,false) ? 1 : 0);"
+        print "}"
+        print ""
+        print "int CallSites()"
+        print "{"
+        print "    int iTotal = 0;"
+        for (i = 0; i < count; i++)
+        {
+            n    = 1 + int(rand()*8)
+            line = "    iTotal += SomeFunction(" keys[1 + int(rand()*4)]
+            for (j = 1; j < n; j++) line = line ", " keys[1 + int(rand()*4)]
+            print line ");"
+        }
+        print "    return iTotal;"
+        print "}"
+    }'
+}
+
+# Compile $2 with headers from $1 three times, and print the fastest time and the object size
+
+Compile()
+{
+    local fBest=""
+    for i in 1 2 3; do
+        local tStart=$(date +%s.%N)
+        "$CXX" -std=c++17 -O2 -I"$1" -c "$2" -o "$TMP/sites.o" || exit 2
+        local tEnd=$(date +%s.%N)
+        fBest=$(awk -v t="$(awk "BEGIN { print $tEnd - $tStart }")" -v best="$fBest" 'BEGIN { print (best == "" || t < best) ? t : best }')
+    done
+    printf "%8.2fs %9d bytes" "$fBest" "$(stat -c %s "$TMP/sites.o")"
+}
+
+printf "%-12s %-28s %-28s\n" "call sites" "fold (C++17)" "recursive (C++11 mode)"
+
+for n in $COUNTS; do
+    Generate "$n" > "$TMP/sites.cpp"
+    printf "%-12s %-28s %-28s\n" "$n" "$(Compile "$ROOT/include" "$TMP/sites.cpp")" "$(Compile "$TMP/recursive" "$TMP/sites.cpp")"
+done
@@ -27,7 +27,8 @@ public:
     // The template interface code for the function.
     //
     // It assembles the keyword values by calling pkw::FillKeyValues(), which
-    // links together all keyword objects on the stack.
+    // stores a pointer to each keyword argument in its KeyValuesPtr slot,
+    // resolved at compile-time from the argument types.
     //
     // This is then transferred to the main function, which is a private
     // class member and its code does not need to be in the interface.
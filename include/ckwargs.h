@@ -179,11 +179,54 @@
 #pragma once
 
 #define keyword_cpp17_support       // uncomment for C++11 and C++14 compatibility
+//#define keyword_header_only       // uncomment to compile ckwargs.cpp code inline (ckwargs.cpp is then not needed)
+
+#ifdef keyword_header_only
+#define _ckwargs_inline inline
+#else
+#define _ckwargs_inline
+#endif
+
+// Namespace-scope constants and tables (i.e. KeySlots) are read by inline functions, and by all of the ckwargs.cpp code
+// in header-only mode, so they need external linkage to be the same object in every source file.
+//
+// With C++17 these are inline variables.  With C++11, a table is a static member of a class template (as with KeyDefaultsT),
+// referred to by name through a constexpr reference.
+
+#ifdef keyword_cpp17_support
+#define _ckwargs_constexpr                          inline constexpr
+#define _ckwargs_table(_type,_name,_count,...)      inline constexpr _type _name[_count] = { __VA_ARGS__ };
+#else
+#define _ckwargs_constexpr                          static constexpr
+#define _ckwargs_table(_type,_name,_count,...)      template<class T = void> struct _name##T { static constexpr _type values[_count] = { __VA_ARGS__ }; };   \
+                                                    template<class T> constexpr _type _name##T<T>::values[_count];                                          \
+                                                    static constexpr const _type (& _name)[_count] = _name##T<>::values;
+#endif
+
+#ifndef keyword_sparse_max
+#define keyword_sparse_max  16      // Maximum number of different keywords held by KeyValuesSparse
+#endif
+
+#ifndef keyword_cache_max
+#define keyword_cache_max   16      // Maximum number of keywords in a KeyCache signature
+#endif
+
+#ifndef keyword_frozen_bytes
+#define keyword_frozen_bytes 256    // Value storage in a KeyFrozen, in bytes
+#endif
+
+#ifndef keyword_dispatch_max
+#define keyword_dispatch_max 16     // Maximum number of specialized functions in a KeyDispatch table
+#endif
 
 #include <cstdlib>
-#include <functional>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <cassert>
 #ifdef keyword_cpp17_support
 #include <optional>
+#include <memory_resource>
 #endif
 
 
@@ -215,12 +258,544 @@
 #endif
 #endif
 
+namespace ckwargs
+{
+    // --------------------------------
+    // KeyMaskT -- keyword presence mask
+    // --------------------------------
+    //
+    // One bit per keyword, indexed by the Keywords value.  FillKeyValues() sets the bit for 
+    // each keyword used, so functions can test for "no keywords" or an exact set of keywords with
+    // a single compare, rather than one branch per keyword.
+    //
+    // Keyword sets larger than 64 use multiple words.  
+    //
+    // KeyMask is declared in my_keydefs.h for the keyword set.
+    //
+    template<typename Key,int Count>
+    struct KeyMaskT
+    {
+        static constexpr int Words = (Count + 63)/64;
+
+        unsigned long long bits[Words];
+
+        __forceinline void Set(Key key)         { bits[(int) key >> 6] |= 1ull << ((int) key & 63); }
+        __forceinline bool Has(Key key) const   { return (bits[(int) key >> 6] >> ((int) key & 63)) & 1; }
+
+        // True if any keyword was used
+
+        __forceinline bool Any() const 
+        { 
+            unsigned long long uBits = 0;
+            for (int i=0;i<Words;i++) uBits |= bits[i];
+            return uBits != 0;
+        }
+
+        __forceinline bool operator == (const KeyMaskT & mask) const
+        {
+            unsigned long long uDiff = 0;
+            for (int i=0;i<Words;i++) uDiff |= bits[i] ^ mask.bits[i];
+            return !uDiff;
+        }
+
+        __forceinline bool operator != (const KeyMaskT & mask) const { return !operator==(mask); }
+
+        // Returns a mask for a set of keywords, i.e. KeyMask::Of<Keywords::Range,Keywords::Text>()
+        //
+        template<Key... keys>
+        static KeyMaskT Of() 
+        { 
+            KeyMaskT mask{}; 
+            int iDummy[] = { 0, (mask.Set(keys),0)... };
+            (void) iDummy;
+            return mask;
+        }
+
+        // Returns the number of keywords set before 'key' (i.e. its position in a list of keywords used, 
+        // in Keywords order -- see KeyValuesSparse)
+        //
+        __forceinline int Rank(Key key) const
+        {
+            int iWord  = (int) key >> 6;
+            int iRank  = PopCount(bits[iWord] & ((1ull << ((int) key & 63)) - 1));
+
+            for (int i=0;i<iWord;i++) iRank += PopCount(bits[i]);
+            return iRank;
+        }
+
+        static __forceinline int PopCount(unsigned long long uBits)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(uBits);
+#else
+            uBits = uBits - ((uBits >> 1) & 0x5555555555555555ull);
+            uBits = (uBits & 0x3333333333333333ull) + ((uBits >> 2) & 0x3333333333333333ull);
+            uBits = (uBits + (uBits >> 4)) & 0x0f0f0f0f0f0f0f0full;
+            return (int) ((uBits * 0x0101010101010101ull) >> 56);
+#endif
+        }
+    };
+
+    // -------------------------------
+    // KeySlot -- keyword offset table
+    // -------------------------------
+    //
+    // Location of a keyword in KeyValuesPtr (ptrOffset) and KeyValuesStruct (structOffset),
+    // along with its size.  The KeySlots table is declared in my_keydefs.h with one entry per keyword.
+    //
+    struct KeySlot
+    {
+        unsigned int ptrOffset;
+        unsigned int structOffset;
+        unsigned int size;
+        unsigned int nodeOffset;        // Offset of the value in its ckwkey object
+        unsigned int align;             // Alignment of the keyword's type
+    };
+
+    // Size of the ckw object header (see ckw).  A keyword value is stored directly after the header, at the next
+    // offset aligned for the value's type, so its location can be found from the header without storing a pointer to it.
+    //
+    _ckwargs_constexpr std::size_t KeyHeaderSize = sizeof(void *) + 2*sizeof(int);
+
+    constexpr std::size_t KeyNodeOffset(std::size_t align) { return (KeyHeaderSize + align - 1) & ~(align - 1); }
+
+    // ----------------------------------
+    // keyref -- by-reference keyword type
+    // ----------------------------------
+    //
+    // Keyword values are copied into the keyword object, which is fine for small values, but not for large ones
+    // such as a transform, palette or mesh.  Declaring a keyword's type as keyref<T> in my_keydefs.h stores a pointer to the
+    // object instead, and the keyword is still used as Keyword=value (see Palette in my_keydefs.h and my_keywords.h):
+    //
+    //      _key(Palette, (nullptr), keyref<std::array<unsigned int,256>>)
+    //
+    //      const auto & szPalette = ckw::Get(keys.Palette,szDefaultPalette);     // const T &, no copy
+    //
+    // T doesn't need to be trivially copyable, since only the pointer is stored.  keys.Resolved<Keywords::Palette>() and
+    // KeySnapshot::Get() also return the object rather than the keyref (see KeyResolved below).
+    //
+    // --> The object must exist until the function using the keywords returns.  KeySnapshot, KeyFrozen, KeyPreset and KeyBound
+    //     copy the pointer, not the object, so they must not outlive the object.
+    //
+    template<class T>
+    struct keyref
+    {
+        const T * pValue;
+    };
+
+    // ---------------------------------
+    // keylazy -- lazily-evaluated keyword
+    // ---------------------------------
+    //
+    // For keyword values that are expensive to compute (i.e. measured text extents, derived colors) and may not be used
+    // by the function, declaring a keyword's type as keylazy<T> in my_keydefs.h lets the keyword take a callable returning T,
+    // which is only called when the function reads the keyword (see TextExtent in my_keydefs.h and my_keywords.h):
+    //
+    //      _key(TextExtent, ({0,0}), keylazy<std::array<int,2>>)
+    //
+    //      MyFunction(kw::TextExtent = [&]{ return MeasureText(sText); });     // caller
+    //      auto szExtent = ckw::Get(keys.TextExtent,szDefault);                // MeasureText() is called here, once
+    //
+    // Nothing is allocated -- keylazy holds a pointer to the callable and a call function for its type (i.e. a function
+    // reference), and the result is cached in the keylazy after the first read.  A plain value (i.e. TextExtent = {10,20}, 
+    // or the registry default) is stored as an already-cached result.  keys.Resolved<Keywords::TextExtent>() and 
+    // KeySnapshot::Get() also return the evaluated value, cached in the stored keylazy (see KeyResolved below).
+    //
+    // --> The callable must exist until it is called.  KeyValuesPtr and KeySnapshot are used during the call, so they 
+    //     read it through the pointer.  Copies kept after the call (KeyFrozen, KeyPreset and KeyBound, i.e. Freeze(), 
+    //     Capture(), Preset() and Bind()) call it when the keywords are copied and keep the result, so the callable is 
+    //     always called for them, whether or not the keyword is read later (see KeyEvaluate below).
+    //
+    // --> Since the result is cached in the keyword object, lazy keywords can't be used as constexpr keywords.
+    //
+    // KeyCallable<T,F,R> -- R, if F is a callable returning T (for keyword functions that take a callable, so that other 
+    // argument types don't match them -- see TextExtent in my_keywords.h and my_keyfuncs.h)
+
+    template<class T,class F,class R>
+    using KeyCallable = typename std::enable_if<std::is_convertible<decltype(std::declval<const F &>()()),T>::value,R>::type;
+
+    template<class T>
+    struct keylazy
+    {
+        static_assert(std::is_trivially_copyable<T>::value,"keylazy types must be trivially copyable");
+
+        const void *    pObject;                    // Callable (not owned)
+        T            (* pCall)(const void *);       // Calls pObject as its original type
+        mutable T       tValue;                     // Cached result
+        mutable bool    bCached;
+
+        constexpr keylazy(std::nullptr_t = nullptr) : pObject(nullptr), pCall(nullptr), tValue(), bCached(false) { }
+        constexpr keylazy(T tValue) : pObject(nullptr), pCall(nullptr), tValue(tValue), bCached(true) { }       // Already-cached value
+        constexpr keylazy(const void * pObject,T (* pCall)(const void *),T tValue,bool bCached) 
+            : pObject(pObject), pCall(pCall), tValue(tValue), bCached(bCached) { }
+
+        // Returns the cached value, calling the callable on the first read
+        //
+        __forceinline const T & Value() const
+        {
+            if (!bCached && pCall) { tValue = pCall(pObject); bCached = true; }
+            return tValue;
+        }
+
+        template<class F>
+        static T Call(const void * pObject) { return (*(const F *) pObject)(); }
+
+        template<class F>
+        static constexpr KeyCallable<T,F,keylazy> Of(const F & fCallable) { return keylazy(&fCallable,&Call<F>,T(),false); }
+        static constexpr keylazy                  Of(T tValue)            { return keylazy(tValue); }
+    };
+
+    // KeyResolved -- what Resolved() and KeySnapshot::Get() return for a keyword type.  This is the value itself, except:
+    //
+    //      keyref<T>   -- the object referred to, as a const T & (the same as ckw::Get()).  The default keyref has no 
+    //                     object, and returns a static T().
+    //      keylazy<T>  -- the evaluated T, read through the stored keylazy so that the result is cached where the
+    //                     keyword is stored, rather than in a copy (the default keylazy has no callable, and returns T()).
+    //
+    // Default() makes the registry default from its value in my_keydefs.h (a keylazy<T> default is given as its T, i.e. 
+    // ({0,0})), and Evaluate() is what KeyEvaluate() does to a copy kept after the call (see below).  
+
+    template<class T>
+    struct KeyResolved
+    {
+        using value = T;
+        using type  = T;
+
+        static constexpr bool lazy = false;
+
+        static __forceinline const T & Get(const T & tValue) { return tValue; }
+        static constexpr T Default(const T & tValue) { return tValue; }
+        static __forceinline void Evaluate(T &) { }
+    };
+
+    template<class T>
+    struct KeyResolved<keyref<T>>
+    {
+        using value = T;
+        using type  = const T &;
+
+        static constexpr bool lazy = false;
+
+        static __forceinline const T & Get(const keyref<T> & tValue) 
+        { 
+            static const T tDefault{};
+            return tValue.pValue ? *tValue.pValue : tDefault; 
+        }
+        static constexpr keyref<T> Default(const keyref<T> & tValue) { return tValue; }
+        static __forceinline void Evaluate(keyref<T> &) { }
+    };
+
+    template<class T>
+    struct KeyResolved<keylazy<T>>
+    {
+        using value = T;
+        using type  = const T &;
+
+        static constexpr bool lazy = true;
+
+        static __forceinline const T & Get(const keylazy<T> & tValue) { return tValue.Value(); }
+        static constexpr keylazy<T> Default(const T & tValue)   { return keylazy<T>(tValue); }
+        static constexpr keylazy<T> Default(std::nullptr_t)     { return keylazy<T>(); }
+
+        // Replaces the callable with its result, so the keylazy no longer points to the callable, and reading it doesn't
+        // write to the cache (i.e. a KeyFrozen read by more than one thread)
+        //
+        static __forceinline void Evaluate(keylazy<T> & tValue) { tValue = keylazy<T>(tValue.Value()); }
+    };
+}
+
 #include "my_keydefs.h"        // Include keyword definitions for ckwargs namespace
 
 // Main Named Parameter namespace -- rename as appropriate
 
 namespace ckwargs
 {
+    // KeyTable<F,T>::values -- a table with F::Entry<key>() for each keyword, in Keywords order, built from KeyList 
+    // (see my_keydefs.h) rather than the keyword list macro, i.e. KeySchema::Map and KeyIsText.
+
+    template<class F,class T,class Void,class... Keys>
+    struct __keytable { static constexpr T values[KeywordCount] = { F::template Entry<Keys::value>()... }; };
+
+    template<class F,class T,class Void,class... Keys> constexpr T __keytable<F,T,Void,Keys...>::values[KeywordCount];
+
+    template<class F,class T> 
+    using KeyTable = KeyList<__keytable,F,T>;
+
+    // KeyEvaluate -- evaluates a keylazy value in place (i is the keyword index, pValue its value), for copies that are kept
+    // after the call -- KeyFrozen, KeyPreset and KeyBound (see keylazy above).  Other keyword types are left as they are.
+
+    using KeyEvaluateFn = void (*)(void *);
+
+    struct __keyevaluate 
+    { 
+        template<Keywords key> 
+        static void Evaluate(void * pValue) { KeyResolved<typename KeyInfo<key>::type>::Evaluate(*(typename KeyInfo<key>::type *) pValue); }
+
+        template<Keywords key> 
+        static constexpr KeyEvaluateFn Entry() { return KeyResolved<typename KeyInfo<key>::type>::lazy ? &Evaluate<key> : nullptr; } 
+    };
+
+    inline void KeyEvaluate(int i,void * pValue)
+    {
+        KeyEvaluateFn fEvaluate = KeyTable<__keyevaluate,KeyEvaluateFn>::values[i];
+        if (fEvaluate) fEvaluate(pValue);
+    }
+
+    // -------------------------------------------
+    // KeySnapshot -- contiguous copy of keywords
+    // -------------------------------------------
+    //
+    // KeyValuesPtr points into the ckw objects, which are spread out across the caller's stack.  For functions that
+    // read most of their keywords (or read them more than once), FillKeySnapshot() can be used instead, which
+    // copies the values of the keywords used into one contiguous, cache-aligned structure.
+    //
+    // keyMask has the keywords that were used -- values for keywords that were not used are left uninitialized.
+    //
+    // i.e. auto BorderSize = snapshot.Get<Keywords::BorderSize>(10); 
+    //
+    struct alignas(64) KeySnapshot
+    {
+        KeyMask         keyMask;
+        KeyValuesStruct values;
+
+        // Get a value if it is defined, or return the default value if it isn't. 
+        //
+        // This returns a copy (the same as ckw::Get()), since the default may be a temporary, i.e. Get<Keywords::BorderSize>(10)
+        //
+        template<Keywords key>
+        __forceinline typename KeyInfo<key>::value Get(const typename KeyInfo<key>::value & defvalue) const
+        {
+            return keyMask.Has(key) ? KeyResolved<typename KeyInfo<key>::type>::Get(KeyInfo<key>::Field(values)) : defvalue;
+        }
+
+        // Returns a pointer to the value, or nullptr if the keyword was not used (the same as KeyValuesPtr)
+        //
+        template<Keywords key>
+        __forceinline const typename KeyInfo<key>::type * Get() const
+        {
+            return keyMask.Has(key) ? &KeyInfo<key>::Field(values) : nullptr;
+        }
+
+        // Returns the value, or its registry default if the keyword was not used, without a branch 
+        // (see KeyDefaults in my_keydefs.h)
+        //
+        template<Keywords key>
+        __forceinline typename KeyInfo<key>::resolved Resolved() const
+        {
+            const typename KeyInfo<key>::type * pSelect[2] = { &KeyInfo<key>::Field(KeyDefaults::values), &KeyInfo<key>::Field(values) };
+            return KeyResolved<typename KeyInfo<key>::type>::Get(*pSelect[keyMask.Has(key)]);
+        }
+
+        // Evaluates the keylazy values used, in place (see KeyEvaluate above) -- for a snapshot kept after the call
+        //
+        void Evaluate()
+        {
+            for (int i=0;i<KeywordCount;i++)
+                if (keyMask.Has((Keywords) i)) KeyEvaluate(i,(char *) &values + KeySlots[i].structOffset);
+        }
+
+        // Returns a KeyValuesPtr that points to the values in this snapshot, for functions that take a KeyValuesPtr
+        // (the snapshot must stay in scope while it is used)
+        //
+        const KeyValuesPtr FillKeyValues() const
+        {
+            KeyValuesPtr kValues{};
+            kValues.keyMask = keyMask;
+
+            for (int i=0;i<KeywordCount;i++)
+            {
+                if (!keyMask.Has((Keywords) i)) continue;
+
+                const void * pValue = (const char *) &values + KeySlots[i].structOffset;
+                memcpy((char *) &kValues + KeySlots[i].ptrOffset,&pValue,sizeof(pValue));
+            }
+            return kValues;
+        }
+    };
+
+    // ---------------------------------------------
+    // KeyFrozen -- self-contained keyword values
+    // ---------------------------------------------
+    //
+    // ckw objects (and the values they hold) are temporaries that only last until the end of the function call, so a
+    // keyword set can't be kept or handed to another thread as-is.  ckw::Freeze() and pkw::Capture(args...) copy the 
+    // values used into a KeyFrozen, which holds only the keyMask and the values, packed in Keywords order into 
+    // fixed inline storage.  
+    //
+    // KeyFrozen has no pointers into itself, so it can be copied or moved anywhere with memcpy (i.e. into a work queue),
+    // and FillKeyValues() returns a KeyValuesPtr that points to the values where they are, without copying them:
+    //
+    //      KeyFrozen frozen = kwx.Freeze();        // or pkw::Capture(args...)
+    //      ... (on the worker thread)
+    //      auto keys = frozen.FillKeyValues();     // frozen must stay in scope while keys is used
+    //
+    // Values that don't fit in keyword_frozen_bytes are dropped (their keyMask bit is cleared) and bOverflow is set.
+    // As with KeyBound, pointer values (i.e. Text) are copied as pointers, so what they point to must still exist.
+    // keylazy values are evaluated when they are copied (see KeyEvaluate).
+    //
+    // Keyword values packed in Keywords order (KeyFrozen and KeyPreset) -- each value is placed at the next offset 
+    // aligned for its type.  KeyPacked() returns a KeyValuesPtr pointing to the packed values.
+
+    // The packed values are aligned relative to the start of the storage, so the storage is aligned for the keyword type
+    // with the largest alignment (KeyValuesStruct holds one of each keyword type).
+
+    _ckwargs_constexpr std::size_t KeyMaxAlign = alignof(KeyValuesStruct);
+
+    constexpr std::size_t KeyPackOffset(std::size_t iOffset,const KeySlot & stSlot)
+    {
+        return (iOffset + stSlot.align - 1) & ~((std::size_t) stSlot.align - 1);
+    }
+
+    inline const KeyValuesPtr KeyPacked(const KeyMask & keyMask,const unsigned char * pData)
+    {
+        KeyValuesPtr kValues{};
+        kValues.keyMask = keyMask;
+
+        std::size_t iOffset = 0;
+
+        for (int i=0;i<KeywordCount;i++)
+        {
+            if (!keyMask.Has((Keywords) i)) continue;
+
+            iOffset = KeyPackOffset(iOffset,KeySlots[i]);
+
+            const void * pValue = pData + iOffset;
+            memcpy((char *) &kValues + KeySlots[i].ptrOffset,&pValue,sizeof(pValue));
+            iOffset += KeySlots[i].size;
+        }
+        return kValues;
+    }
+
+    struct KeyFrozen
+    {
+        KeyMask         keyMask;
+        bool            bOverflow;
+        alignas(16) alignas(KeyMaxAlign) unsigned char data[keyword_frozen_bytes];
+
+        KeyFrozen() : keyMask{}, bOverflow(false) { }
+
+        // Pack the values in a KeySnapshot
+        //
+        explicit KeyFrozen(const KeySnapshot & snapshot) : keyMask{}, bOverflow(false)
+        {
+            std::size_t iOffset = 0;
+
+            for (int i=0;i<KeywordCount;i++)
+            {
+                if (!snapshot.keyMask.Has((Keywords) i)) continue;
+
+                const KeySlot & stSlot = KeySlots[i];
+                std::size_t iStart = KeyPackOffset(iOffset,stSlot);
+
+                if (iStart + stSlot.size > keyword_frozen_bytes) { bOverflow = true; continue; }
+
+                memcpy(data + iStart,(const char *) &snapshot.values + stSlot.structOffset,stSlot.size);
+                KeyEvaluate(i,data + iStart);
+                keyMask.Set((Keywords) i);
+                iOffset = iStart + stSlot.size;
+            }
+        }
+
+        // Returns a KeyValuesPtr pointing to the values in this object
+        //
+        __forceinline const KeyValuesPtr FillKeyValues() const { return KeyPacked(keyMask,data); }
+    };
+
+    static_assert(std::is_trivially_copyable<KeyFrozen>::value,"KeyFrozen must be trivially copyable");
+    static_assert(alignof(KeyFrozen) >= KeyMaxAlign,"KeyFrozen storage is not aligned for all keyword types");
+
+    // ---------------------------------------------
+    // KeyValuesSparse -- keyword pointers, as a list
+    // ---------------------------------------------
+    //
+    // KeyValuesPtr has a pointer for every keyword in the keyword set, all of which are cleared on each call.  For large
+    // keyword sets, FillKeySparse() can be used instead, which keeps pointers only for the keywords used,
+    // so the cost is based on the number of keywords passed rather than the size of the keyword set.
+    //
+    // The pointers are kept in Keywords order, so a keyword's position is the number of keywords set in keyMask 
+    // before it -- Get<Keywords::X>() is a bit test and a popcount, not a search.
+    //
+    // Up to keyword_sparse_max different keywords are kept, so this should be set to at least the number of keywords 
+    // any one function call may use.  pkw::FillKeySparse() checks this at compile-time.  For streamed lists, going past it
+    // asserts in debug builds, and sets bOverflow (the keyword is not stored) otherwise.
+    //
+    // i.e. auto BorderSize = ckw::Get(keys.Get<Keywords::BorderSize>(),10);
+    //
+    struct KeyValuesSparse
+    {
+        KeyMask         keyMask;
+        int             count;
+        bool            bOverflow;                      // Set if a keyword didn't fit (see note above)
+        const void    * pValues[keyword_sparse_max];
+
+        __forceinline void Clear() { keyMask = KeyMask{}; count = 0; bOverflow = false; }
+
+        // Add or replace a keyword pointer
+        //
+        void Set(Keywords key,const void * pValue)
+        {
+            int iRank = keyMask.Rank(key);
+
+            if (!keyMask.Has(key))
+            {
+                if (count >= keyword_sparse_max)            // Full -- see note above
+                {
+                    assert(!"KeyValuesSparse: more than keyword_sparse_max keywords used");
+                    bOverflow = true;
+                    return;
+                }
+
+                for (int i=count;i>iRank;i--) pValues[i] = pValues[i-1];
+                keyMask.Set(key);
+                count++;
+            }
+            pValues[iRank] = pValue;
+        }
+
+        // Returns a pointer to the value, or nullptr if the keyword was not used (the same as KeyValuesPtr)
+        //
+        template<Keywords key>
+        __forceinline const typename KeyInfo<key>::type * Get() const
+        {
+            return keyMask.Has(key) ? (const typename KeyInfo<key>::type *) pValues[keyMask.Rank(key)] : nullptr;
+        }
+    };
+
+    // --------------------------------------------
+    // KeyCache -- per-call-site keyword resolution
+    // --------------------------------------------
+    //
+    // For call sites that pass the same keywords every time (i.e. in a frame loop), a KeyCache can be kept 
+    // with the call site and passed to ckw::FillKeyValues(KeyCache &).  The keywords used (in list order) are 
+    // saved as the signature on the first call, and later calls with the same signature only store the value 
+    // pointers into the cached KeyValuesPtr -- it is not cleared, and keyMask is not rebuilt.
+    //
+    // A different signature is a miss, and the KeyValuesPtr and signature are rebuilt. Lists with more than 
+    // keyword_cache_max keywords are not cached (each call is a miss).
+    //
+    // hits and misses count the results, to see how well the cache works for a call site.
+    //
+    // note: KeyCache is not thread-safe.  For call sites used by more than one thread, use one per thread, i.e.
+    //
+    //      static thread_local KeyCache cache;
+    //      auto & keys = kwArgs.FillKeyValues(cache);
+    //
+    struct KeyCache
+    {
+        int                 count = -1;                     // Number of keywords in the signature (-1 = none yet)
+        Keywords            keys[keyword_cache_max];        // Signature -- the keywords in list order
+        KeyValuesPtr        kValues{};                      // Resolved keyword pointers from the last call
+        unsigned long long  hits    = 0;
+        unsigned long long  misses  = 0;
+
+        // Clears the signature (the next call is a miss), but not the counters
+        //
+        __forceinline void Reset() { count = -1; }
+    };
+
+    class KeyView;
+    class ckwlist;
+    template<class F> class KeyBound;
 
     // -------------------------------
     // ckw class -- main keyword class 
@@ -245,9 +820,20 @@ namespace ckwargs
     class ckw
     {
     public:        
-        // Operators for adding keywords in streamed version
+        // Operators for adding keywords in streamed version.
+        //
+        // These start a ckwlist (see below), which is the head of the list and keeps track of the
+        // end of the list -- i.e. (Range(1,10), Text("Hello"), BorderSize(5)) is one ckwlist object
+        // that links the three keyword objects together.
+        //
+        // Streaming links the keyword objects by writing their pNext, so the list must start with a temporary keyword
+        // (i.e. Range(1,10) << ...), and constant keywords can't be streamed.  Both are compile errors, rather than
+        // a list that silently loses keywords -- i.e. for 'ckw opts; opts << BorderSize(3)', or a static constexpr keyword.
+
+        template<class T,class R = ckwlist> 
+        using KeyStream = typename std::enable_if<std::is_base_of<ckw,typename std::decay<T>::type>::value,R>::type;
         
-        ckw & operator << (const ckw & Opt);    // Also required for template parameter packed version
+        template<class T> KeyStream<T> operator << (T && Opt) &&;
 
         // These only work for streaming version of keyword functions.
         // For streamed version of keywords, the ',' enclosed by () must be used:
@@ -263,49 +849,72 @@ namespace ckwargs
         // These are not used for the packed-parameter version and can be removed 
         // if the streaming-type is not being used.
 
-        ckw & operator ,  (const ckw & Opt) { return operator <<(Opt); }
-        ckw & operator +  (const ckw & Opt) { return operator <<(Opt); }
-        ckw & operator |  (const ckw & Opt) { return operator <<(Opt); }
+        template<class T> KeyStream<T> operator ,  (T && Opt) &&;
+        template<class T> KeyStream<T> operator +  (T && Opt) &&;
+        template<class T> KeyStream<T> operator |  (T && Opt) &&;
+
+        // Streaming from a named or constant keyword (see above) -- these are deleted so that the built-in ',' isn't 
+        // used instead, which would silently drop the keyword on the left.
+
+        template<class T> KeyStream<T> operator << (T && Opt) const & = delete;
+        template<class T> KeyStream<T> operator ,  (T && Opt) const & = delete;
+        template<class T> KeyStream<T> operator +  (T && Opt) const & = delete;
+        template<class T> KeyStream<T> operator |  (T && Opt) const & = delete;
 
         // ---------------------
         // Stored keyword values  
         // ---------------------
         //
-        // note: By default this is a union, but can be 
-        //       declared as a struct to allow more flexibility,
-        //       such as passing STL elements such as std::pair, vector,
-        //       etc. as well as class object
+        // ckw is the common header for all keyword objects and does not store a value itself.  The value is stored by 
+        // ckwkey<Keywords::X> (below), which holds only that keyword's type, so each keyword object on the stack 
+        // is only as large as its own value, rather than the largest keyword type.
         //
-        //       However, beware that this will cause copying of said objects.
+        // Keyword types must be trivially copyable (see KeyInfo in my_keydefs.h), which
+        // results in a compiler error for anything that has instantiation, copying, move, needs, etc.
         //
-        //       The default union format provides nice protection, because it 
-        //       will result in a compiler error for anything that has instantiation, 
-        //       copying, move, needs, etc.
+        // --------------
+        // ckw header
+        // --------------
         //
-        KeyValues keyValues;    
- 
-        // Basic keyword package, containing the key type and location of its cwk class.
+        // The header is kept to a pointer and two integers (16 bytes for 64-bit), with no padding, so that the 
+        // value of a ckwkey object always starts at KeyNodeOffset() (see KeySlot::nodeOffset).  The value's 
+        // location is not stored, and only ckwlist (the head of a streamed list) keeps track of the end of the list.
+        //
+        // Basic keyword package, containing the key type.
         //
         struct Package
         {
-            Keywords key;
-            ckw * pData;
+            Keywords     key;           // Keyword index, or -1 for an empty ckw (see HasKey())
+            unsigned int reserved;      // Unused -- keeps the header free of tail padding 
         };
 
-        Package package;        // key, location data
-
         const ckw * pNext = nullptr;    // Next ckw object in the chain
-        ckw * pLast       = nullptr;    // Last one we looked at (for packed-parameter compilation)
+        Package     package;            // key data
 
         // Constructors for packed-parameter usage and user-code constructing keyword
         // transfer code (see my_keywords.h example file).
 
-        ckw();  
-        ckw(Keywords key,std::function<void(ckw &)> const & fFunc = nullptr); 
+        // The constructors are constexpr so that keywords made from constants can be built at compile-time
+        // (see "Constant keywords" in ckwkey below)
+
+        __forceinline constexpr ckw() : package{ (Keywords) -1, 0 } { }
+
+        // Keyword constructor (used by ckwkey) -- kept inline so that keyword functions compile down to 
+        // the key and value stores, with no call.
+        //
+        __forceinline constexpr ckw(Keywords key) : package{ key, 0 } { }
+
+        // Keyword constructor with the next keyword already linked (used by ckwchain -- see ckwkey::Link())
+        //
+        __forceinline constexpr ckw(Keywords key,const ckw * pNextKey) : pNext(pNextKey), package{ key, 0 } { }
 
         // Move constructor should only be used when assigning a keyword.
         //
-        ckw(ckw && p2) noexcept;
+        __forceinline constexpr ckw(ckw && p2) noexcept : pNext(p2.pNext), package(p2.package) { }
+
+        // True if this is a keyword (vs. an empty ckw or the head of a ckwlist)
+        //
+        __forceinline bool HasKey() const { return (int) package.key >= 0; }
 
         // Fills a structure with pointers (or std::optionals if turned on) for all keywords
         // that were used.  Values are nullptr (or nullopt) if they were not used. 
@@ -313,6 +922,62 @@ namespace ckwargs
         // Set Get() functions
         //
         const KeyValuesPtr FillKeyValues() const;
+
+        // Same as above, but fills a KeyValuesPtr structure supplied by the caller.
+        // Keywords not found in the list are left untouched.
+        //
+        // In both versions, keyMask is set for each keyword found (see KeyMaskT)
+        //
+        void FillKeyValues(KeyValuesPtr & kValues) const;
+
+        // Fills the KeyValuesPtr kept in a KeyCache, and returns it.  When the keywords are the same as 
+        // the last call, only the value pointers are stored (see KeyCache above)
+        //
+        const KeyValuesPtr & FillKeyValues(KeyCache & cache) const;
+
+        // Copies the values of all keywords used into a KeySnapshot, rather than returning pointers.
+        // The second version adds to the snapshot passed in (i.e. keyMask is not cleared)
+        // 
+        // See KeySnapshot above.
+        //
+        const KeySnapshot FillKeySnapshot() const;
+        void FillKeySnapshot(KeySnapshot & snapshot) const;
+
+        // Fills a KeyValuesSparse with pointers to the keywords used (see KeyValuesSparse above).
+        // The second version adds to the KeyValuesSparse passed in.
+        //
+        const KeyValuesSparse FillKeySparse() const;
+        void FillKeySparse(KeyValuesSparse & kValues) const;
+
+        // Returns a KeyView for looking up keywords one at a time, rather than filling them all
+        // in at once (see KeyView below).
+        //
+        KeyView View() const;
+
+        // Fills a KeySchema with pointers to the keywords used that are in the schema (see KeySchema below)
+        //
+        template<class Schema> 
+        Schema FillKeySchema() const;
+
+        // Returns a user parameter struct with the keywords used copied into it (see KeyMapper below)
+        //
+        template<class Params> 
+        Params Resolve() const;
+
+        // Binds the keywords to a function, returning a callable that can be called many times with only the 
+        // positional arguments (see KeyBound below)
+        //
+        template<class F> 
+        KeyBound<typename std::decay<F>::type> Bind(const F & fFunc) const;
+
+        // Copies the keyword values into a self-contained KeyFrozen that can be kept or handed to another thread 
+        // (see KeyFrozen above)
+        //
+        __forceinline KeyFrozen Freeze() const { return KeyFrozen(FillKeySnapshot()); }
+
+        // Returns a pointer to the keyword value stored in this object.
+        //
+        __forceinline const void * KeyData() const { return (const char *) this + KeySlots[(int) package.key].nodeOffset; }
  
         // Get a value if it is defined, or return the default value if it isn't.
         // Use the std::optional version, or just refer to the key directly to test for
@@ -324,27 +989,878 @@ namespace ckwargs
             return value ? *value : defvalue;
         }
 
-#ifdef keyword_cpp17_support
-
-        // Sets a std::optional to the value of the keyword if it was used, or returns nullopt
-        // if not.
+        // Get for keyref<T> keywords -- returns a reference to the object passed (or the default), without copying it.
         //
-        // This function is completely redundant when _kw_useOptional is used, as the directl values
-        // are already optionals, and this forces a copy.
+        template<typename T>
+        static __forceinline const T & Get(const keyref<T> * const & value,const T & defvalue) 
+        {
+            return value && value->pValue ? *value->pValue : defvalue;
+        }
+
+        // The result can refer to defvalue, so a temporary default (i.e. Get(keys.Palette,MakePalette())) would leave
+        // it dangling -- pass a named default instead.
         //
-        // This routine can be useful when _kw_useOptional is not used to convert to an optional value,
-        // but keep in mind that the memory is value is copied when this happens, so size of the value and
-        // any object issues, copy constructors, etc. should be kept in mind.
+        template<typename T>
+        static const T & Get(const keyref<T> * const & value,const T && defvalue) = delete;
+
+        // Returns a pointer to the object passed to a keyref<T> keyword, or nullptr if the keyword wasn't used.
         //
         template<typename T>
-        static __forceinline std::optional<T> Get(const T * const & value)
+        static __forceinline const T * Get(const keyref<T> * const & value) 
         {
-            return (value ? std::optional<T>(*value) : std::nullopt);
+            return value ? value->pValue : nullptr;
+        }
+
+        // Get for keylazy<T> keywords -- calls the keyword's callable (once) if the keyword was used, or returns the default,
+        // in which case the callable is never called.  This returns a copy, since the default may be a temporary.
+        //
+        template<typename T>
+        static __forceinline T Get(const keylazy<T> * const & value,const T & defvalue) 
+        {
+            return value ? value->Value() : defvalue;
+        }
+
+        // Returns a pointer to the (evaluated) value of a keylazy<T> keyword, or nullptr if the keyword wasn't used.
+        //
+        template<typename T>
+        static __forceinline const T * Get(const keylazy<T> * const & value) 
+        {
+            return value ? &value->Value() : nullptr;
+        }
+
+#ifdef keyword_cpp17_support
+
+        // Sets a std::optional to the value of the keyword if it was used, or returns nullopt
+        // if not.
+        //
+        // This function is completely redundant when _kw_useOptional is used, as the directl values
+        // are already optionals, and this forces a copy.
+        //
+        // This routine can be useful when _kw_useOptional is not used to convert to an optional value,
+        // but keep in mind that the memory is value is copied when this happens, so size of the value and
+        // any object issues, copy constructors, etc. should be kept in mind.
+        //
+        template<typename T>
+        static __forceinline std::optional<T> Get(const T * const & value)
+        {
+            return (value ? std::optional<T>(*value) : std::nullopt);
         }
 
 #endif
     }; // class ckw
 
+    // ----------------------------------------
+    // KeyView -- on-demand lookup of keywords
+    // ----------------------------------------
+    //
+    // FillKeyValues() finds every keyword up front.  For functions that only look at one or two keywords (i.e. check a flag
+    // and return), ckw::View() can be used instead, which looks up only the keywords requested, when they are requested,
+    // by walking the ckw list and stopping as soon as they are found.
+    //
+    //      auto keys = kwx.View();
+    //      if (!ckw::Get(keys.Get<Keywords::AddBorder>(),false)) return;
+    //
+    // Find() looks up more than one keyword in one walk of the list, stopping when all of them are found:
+    //
+    //      const int * pBorderSize; const bool * pAddBorder;
+    //      keys.Find<Keywords::BorderSize,Keywords::AddBorder>(pBorderSize,pAddBorder);
+    //
+    // note: because the search stops at the first match, if a keyword is used more than once, KeyView returns 
+    //       the first one, where FillKeyValues() returns the last one.
+    //
+    class KeyView
+    {
+        const ckw * m_pTop;
+
+        const void * FindKey(Keywords key) const
+        {
+            for (const ckw * pckw = m_pTop; pckw; pckw = pckw->pNext)
+                if (pckw->HasKey() && pckw->package.key == key) return pckw->KeyData();
+
+            return nullptr;
+        }
+
+    public:
+        explicit KeyView(const ckw & kwx) : m_pTop(&kwx) { }
+
+        __forceinline bool Has(Keywords key) const { return FindKey(key) != nullptr; }
+
+        // Returns a pointer to the value, or nullptr if the keyword was not used (the same as KeyValuesPtr)
+        //
+        template<Keywords key>
+        __forceinline const typename KeyInfo<key>::type * Get() const 
+        { 
+            return (const typename KeyInfo<key>::type *) FindKey(key); 
+        }
+
+        // Looks up all keywords given in one pass, setting each pointer to the value or nullptr.
+        // Returns true if all of the keywords were found.
+        //
+        template<Keywords... keys>
+        bool Find(const typename KeyInfo<keys>::type * &... pValues) const
+        {
+            static constexpr int iCount = sizeof...(keys);
+
+            const Keywords kKeys[iCount]    = { keys... };
+            const void   * pFound[iCount]   = { };
+            int            iLeft            = iCount;
+
+            for (const ckw * pckw = m_pTop; pckw && iLeft; pckw = pckw->pNext)
+            {
+                if (!pckw->HasKey()) continue;
+
+                for (int i=0;i<iCount;i++)
+                    if (!pFound[i] && kKeys[i] == pckw->package.key)
+                    {
+                        pFound[i] = pckw->KeyData();
+                        iLeft--;
+                        break;
+                    }
+            }
+
+            int i = 0;
+            int iDummy[] = { 0, (pValues = (const typename KeyInfo<keys>::type *) pFound[i++],0)... };
+            (void) iDummy;
+
+            return !iLeft;
+        }
+    };
+
+    inline KeyView ckw::View() const { return KeyView(*this); }
+
+    // ---------------------------------------------
+    // ckwchain class -- keyword with a linked list
+    // ---------------------------------------------
+    //
+    // Returned by ckwkey::Link() (see "Constant keywords" below).  This holds the keyword value the same way as ckwkey,
+    // but isn't a ckwkey, so the packed-parameter functions treat it as a list (KeyArg is -1) and walk the keywords 
+    // linked to it, rather than taking it as one typed keyword.
+    //
+    // The keywords are linked when it's made, so it can't be streamed with other keywords -- it's passed by itself.
+    //
+    template<Keywords key>
+    class ckwchain : public ckw
+    {
+    public:
+        using type = typename KeyInfo<key>::type;
+
+        type value;         // The keyword value, at the same offset as in ckwkey
+
+        __forceinline constexpr ckwchain(const type & value,const ckw & kwNext) : ckw(key,&kwNext), value(value) 
+        { 
+            static_assert(sizeof(ckwchain) == ((KeyInfo<key>::offset + sizeof(type) + alignof(ckwchain) - 1) & ~(alignof(ckwchain) - 1)),
+                          "ckwchain value is not at KeyInfo::offset");
+        }
+
+        constexpr ckwchain(ckwchain && p2) noexcept : ckw(static_cast<ckw &&>(p2)), value(p2.value) { }
+
+        // Streaming would replace the link to the next keyword, so these are deleted (see ckwlist::Streamed() for the 
+        // other side)
+
+        template<class T> void operator << (T && Opt) const = delete;
+        template<class T> void operator ,  (T && Opt) const = delete;
+        template<class T> void operator +  (T && Opt) const = delete;
+        template<class T> void operator |  (T && Opt) const = delete;
+    };
+
+    template<class T> struct KeyIsChain                     : std::false_type { };
+    template<Keywords k> struct KeyIsChain<ckwchain<k>>     : std::true_type  { };
+
+    // ----------------------------------------------
+    // ckwkey class -- ckw object with a typed keyword
+    // ----------------------------------------------
+    //
+    // This is the same as a ckw object, except the keyword is also part of the type.  Keyword functions
+    // (see my_keywords.h and my_keyfuncs.h) return a ckwkey so that the packed-parameter FillKeyValues() can 
+    // map each argument to its KeyValuesPtr slot when the template is instantiated -- this turns the 
+    // call into a few pointer stores, without linking the ckw objects together or walking the list.
+    //
+    // ckwkey is a ckw, so it can be streamed and passed as a 'const ckw &' as before.
+    //
+    template<Keywords key>
+    class ckwkey : public ckw
+    {
+    public:
+        using type = typename KeyInfo<key>::type;
+
+        type value;         // The keyword value -- only the size of this keyword's type
+
+        ckwkey() : ckw(key) { }
+
+        // Set the keyword value directly, i.e. return ckwkey<Keywords::BorderSize>(value);
+        //
+        // This is what the keyword operators and functions in my_keywords.h/my_keyfuncs.h use.
+        //
+        // (the layout check is here rather than in a function so that the constructor can be constexpr in C++11)
+        //
+        __forceinline constexpr ckwkey(const type & value) : ckw(key), value(value) 
+        { 
+            static_assert(sizeof(ckwkey) == ((KeyInfo<key>::offset + sizeof(type) + alignof(ckwkey) - 1) & ~(alignof(ckwkey) - 1)),
+                          "ckwkey value is not at KeyInfo::offset");
+        }
+
+        // Fill in the value from a function or lambda, i.e. 
+        //
+        //      ckwkey<Keywords::Range>([&](std::array<int,2> & value) { value = { iMin, iMax }; });
+        //
+        // The function is called directly (it is not wrapped in a std::function), so the lambda is inlined
+        // into the keyword function.
+        //
+        template<typename F, typename = decltype(std::declval<const F &>()(std::declval<type &>()))>
+        __forceinline ckwkey(const F & fFunc) : ckw(key) { fFunc(value); }
+
+        constexpr ckwkey(ckwkey && p2) noexcept : ckw(static_cast<ckw &&>(p2)), value(p2.value) { }
+
+        // ------------------
+        // Constant keywords
+        // ------------------
+        //
+        // Keyword construction is constexpr, so a keyword set made only of constants can be built at compile-time 
+        // as a static constexpr object (or C++20 constinit), with no per-call construction:
+        //
+        //      static constexpr auto kBorder = kw::BorderSize = 10;            
+        //      static constexpr auto kKeys   = (kw::Range = {1,10}).Link(kBorder);    // Range -> BorderSize
+        //
+        //      MyFunction(1234,kKeys);             // Streamed version (const ckw &)
+        //      MyFunction(1234,kKeys);             // Packed-parameter version (Range and BorderSize)
+        //
+        // Link() returns a ckwchain (see above) with a copy of this keyword's value and kwNext as the next keyword in 
+        // the chain, so that a constant list can be put together without the streaming operators.  Longer lists are 
+        // linked from the end, i.e. static constexpr auto kKeys2 = (kw::AddBorder = true).Link(kKeys);
+        //
+        // Constant keywords and chains are passed by themselves -- streaming them with other keywords 
+        // (i.e. (kBorder, kw::Text="Hello")) is a compile error, since streaming writes to the keyword's pNext.
+        //
+        // The chain keeps a pointer to kwNext, so kwNext can't be a temporary, i.e. Link(kw::BorderSize = 10) is a 
+        // compile error -- declare the next keyword first, as with kBorder above.
+        //
+        __forceinline constexpr ckwchain<key> Link(const ckw & kwNext) const { return ckwchain<key>(value,kwNext); }
+        ckwchain<key> Link(const ckw && kwNext) const = delete;
+    };
+
+    // ckw header size regression check -- see KeyHeaderSize
+
+    static_assert(sizeof(ckw) == KeyHeaderSize,"ckw header size has changed");
+
+    // -----------------------------------------
+    // ckwlist class -- head of a streamed list
+    // -----------------------------------------
+    //
+    // Returned by the streaming operators in ckw, i.e. (Range(1,10), Text("Hello")) or Range(1,10) << Text("Hello").
+    // 
+    // ckwlist is an empty ckw that points to the first keyword in the list, and also keeps the last one 
+    // so that keywords can be added to the end of the list.  The keyword objects themselves don't need to 
+    // keep track of the end of the list.
+    //
+    class ckwlist : public ckw
+    {
+    public:
+        ckw * pLast;        // Last keyword in the list
+
+        ckwlist(ckw & kwFirst,ckw & kwNext)
+        {
+            pNext = &kwFirst;
+            pLast = &kwFirst;
+            Add(kwNext);
+        }
+
+        ckwlist(ckwlist && p2) noexcept : ckw(std::move(p2)), pLast(p2.pLast) { }
+
+        // Add a keyword to the end of the list (the keyword objects are linked, but not copied)
+        //
+        __forceinline void Add(ckw & Opt)
+        {
+            pLast->pNext = &Opt;
+            pLast = &Opt;
+        }
+
+        // Returns the keyword to be linked into the list, which can't be a constant keyword (see ckw above)
+        //
+        template<class T>
+        static __forceinline ckw & Streamed(T && Opt)
+        {
+            static_assert(!std::is_const<typename std::remove_reference<T>::type>::value,
+                          "Constant keywords can't be streamed (streaming writes their pNext) -- pass them by themselves");
+            static_assert(!KeyIsChain<typename std::decay<T>::type>::value,
+                          "Linked keywords (see ckwkey::Link()) can't be streamed -- pass them by themselves");
+            return Opt;
+        }
+
+        template<class T> __forceinline KeyStream<T,ckwlist &> operator << (T && Opt) { Add(Streamed(std::forward<T>(Opt))); return *this; }
+        template<class T> __forceinline KeyStream<T,ckwlist &> operator ,  (T && Opt) { Add(Streamed(std::forward<T>(Opt))); return *this; }
+        template<class T> __forceinline KeyStream<T,ckwlist &> operator +  (T && Opt) { Add(Streamed(std::forward<T>(Opt))); return *this; }
+        template<class T> __forceinline KeyStream<T,ckwlist &> operator |  (T && Opt) { Add(Streamed(std::forward<T>(Opt))); return *this; }
+    };
+
+    template<class T> inline ckw::KeyStream<T> ckw::operator << (T && Opt) && { return ckwlist(*this,ckwlist::Streamed(std::forward<T>(Opt))); }
+    template<class T> inline ckw::KeyStream<T> ckw::operator ,  (T && Opt) && { return ckwlist(*this,ckwlist::Streamed(std::forward<T>(Opt))); }
+    template<class T> inline ckw::KeyStream<T> ckw::operator +  (T && Opt) && { return ckwlist(*this,ckwlist::Streamed(std::forward<T>(Opt))); }
+    template<class T> inline ckw::KeyStream<T> ckw::operator |  (T && Opt) && { return ckwlist(*this,ckwlist::Streamed(std::forward<T>(Opt))); }
+
+    // ------------------------------------------------------------
+    // KeySignature -- compile-time keyword presence (packed form)
+    // ------------------------------------------------------------
+    //
+    // In the packed-parameter form, the keywords passed are known at compile-time from the argument types.
+    // pkw::Has<Keywords::X,Args...>::value tells if a keyword was passed, and pkw::Signature(args...) returns a 
+    // KeySignature with one flag per keyword (in Keywords order), so the same keywords give the same type regardless
+    // of the order they were passed in.  
+    //
+    // The signature can be passed on to a template implementation function, so that code for keywords that weren't
+    // used is removed entirely:
+    //
+    //      template <class... Args>
+    //      void SomeFunction(const char * sTitle,const Args&... kwArgs)
+    //      {
+    //          SomeFunctionImpl(sTitle,pkw::FillKeyValues(kwArgs...),pkw::Signature(kwArgs...));
+    //      }
+    //
+    //      template <class Sig>
+    //      void SomeFunctionImpl(const char * sTitle,const KeyValuesPtr & keys,Sig)
+    //      {
+    //          if constexpr (Sig::Has(Keywords::AddBorder)) { ... use keys.AddBorder ... }
+    //      }
+    //
+    // An untyped argument (i.e. a streamed list passed as one argument) can hold any keyword, so when one is passed
+    // every keyword is reported as present.  false always means the keyword was not passed -- when it is true, the 
+    // keyword pointer should still be checked.
+
+    // Keyword for a packed-parameter argument type, or -1 for an untyped ckw
+    //
+    template<class Arg> struct KeyArg               { static constexpr int key = -1;        };
+    template<Keywords k> struct KeyArg<ckwkey<k>>   { static constexpr int key = (int) k;   };
+
+#ifdef keyword_cpp17_support
+    template<Keywords key,class... Args>
+    struct KeyHas : std::integral_constant<bool,(false || ... || (KeyArg<Args>::key == (int) key || KeyArg<Args>::key < 0))> { };
+#else
+    template<Keywords key,class... Args> 
+    struct KeyHas : std::false_type { };
+
+    template<Keywords key,class Arg,class... Args>
+    struct KeyHas<key,Arg,Args...> : std::integral_constant<bool,KeyArg<Arg>::key == (int) key || KeyArg<Arg>::key < 0 || KeyHas<key,Args...>::value> { };
+#endif
+
+    template<bool... bHas>
+    struct KeySignature
+    {
+        static_assert(sizeof...(bHas) == KeywordCount,"KeySignature needs one flag per keyword");
+
+        static constexpr bool bits[KeywordCount] = { bHas... };
+
+        static constexpr bool Has(Keywords key) { return bits[(int) key]; }
+
+        // The signature as a KeyMask, i.e. to compare with keyMask in KeyValuesPtr
+        //
+        static KeyMask Mask() 
+        { 
+            KeyMask mask{};
+            for (int i=0;i<KeywordCount;i++) if (bits[i]) mask.Set((Keywords) i);
+            return mask;
+        }
+    };
+
+    template<bool... bHas> constexpr bool KeySignature<bHas...>::bits[KeywordCount];
+
+    // KeySignature for a packed-parameter argument list, with KeyHas for each keyword (see KeyList in my_keydefs.h)
+
+    template<class... Args> 
+    struct __keysignature 
+    { 
+        template<class Void,class... Keys> using type = KeySignature<KeyHas<Keys::value,Args...>::value...>; 
+    };
+
+    template<class... Args>
+    using KeySignatureOf = KeyList<__keysignature<Args...>::template type>;
+
+    // KeySignature for a list of keywords, i.e. KeySignatureFor<Keywords::Range,Keywords::AddBorder>, and for any keyword
+
+    template<Keywords... keys> 
+    using KeySignatureFor = KeySignatureOf<ckwkey<keys>...>;
+
+    using KeySignatureAny = KeySignatureOf<ckw>;
+
+    // --------------------------------------------------------
+    // KeyDispatch -- run-time signature dispatch (object form)
+    // --------------------------------------------------------
+    //
+    // For the streamed (object) form, the keywords passed are only known at run-time.  KeyDispatch keeps a small table of
+    // implementations specialized for the most-used keyword combinations, plus a generic version for everything else.
+    // The keyMask built by FillKeyValues() is compared against the table, and the matching function is called, so the
+    // specialized versions don't need to check for keywords or supply defaults.
+    //
+    // The table is set up once per function, i.e. with a template implementation that takes a KeySignature (see above):
+    //
+    //      template <class Sig>
+    //      static void DrawBoxImpl(const KeyValuesPtr & keys,int iSize)
+    //      {
+    //          if constexpr (Sig::Has(Keywords::AddBorder)) { ... }
+    //      }
+    //
+    //      void DrawBox(int iSize,const ckw & kwx = ckw())
+    //      {
+    //          static const auto dispatch = KeyDispatch<void(int)>(DrawBoxImpl<KeySignatureAny>)
+    //                                          .Add<>(DrawBoxImpl<KeySignatureFor<>>)
+    //                                          .Add<Keywords::AddBorder>(DrawBoxImpl<KeySignatureFor<Keywords::AddBorder>>);
+    //          dispatch(kwx,iSize);
+    //      }
+    //
+    // A specialized function is only called when the keywords used are exactly the keywords it was registered with,
+    // so its keyword pointers are never nullptr.  The generic function gets everything else and should check the 
+    // pointers as usual (KeySignatureAny reports every keyword as present).
+    //
+    // Up to keyword_dispatch_max functions can be added to a table -- functions past that are ignored and the generic
+    // version is used for their keywords.
+    //
+    template<class Fn> class KeyDispatch;
+
+    template<class R,class... Args>
+    class KeyDispatch<R(Args...)>
+    {
+    public:
+        using Func = R (*)(const KeyValuesPtr & keys,Args... args);
+
+    private:
+        struct Entry
+        {
+            KeyMask keyMask;
+            Func    fFunc;
+        };
+
+        Entry   m_stEntries[keyword_dispatch_max];
+        int     m_iCount = 0;
+        Func    m_fGeneric;
+
+    public:
+        explicit KeyDispatch(Func fGeneric) : m_fGeneric(fGeneric) { }
+
+        // Add a specialized function for an exact set of keywords, i.e. Add<Keywords::Range,Keywords::Text>(fFunc)
+        //
+        template<Keywords... keys>
+        KeyDispatch & Add(Func fFunc) { return Add(KeyMask::Of<keys...>(),fFunc); }
+
+        KeyDispatch & Add(const KeyMask & keyMask,Func fFunc)
+        {
+            if (m_iCount < keyword_dispatch_max) m_stEntries[m_iCount++] = { keyMask, fFunc };
+            return *this;
+        }
+
+        // Returns the function for a set of keywords, or the generic function if there isn't one
+        //
+        __forceinline Func Find(const KeyMask & keyMask) const
+        {
+            for (int i=0;i<m_iCount;i++) if (m_stEntries[i].keyMask == keyMask) return m_stEntries[i].fFunc;
+            return m_fGeneric;
+        }
+
+        // Call the function for keywords that have already been filled in (this also works for the packed form)
+        //
+        __forceinline R Call(const KeyValuesPtr & keys,Args... args) const { return Find(keys.keyMask)(keys,args...); }
+
+        // Fill in the keywords and call the function for them
+        //
+        __forceinline R operator () (const ckw & kwx,Args... args) const 
+        { 
+            const KeyValuesPtr keys = kwx.FillKeyValues();
+            return Call(keys,args...);
+        }
+    };
+
+    // ------------------------------------------
+    // KeySchema -- per-function keyword subset
+    // ------------------------------------------
+    //
+    // KeyValuesPtr has a pointer for every keyword in the keyword set, even for functions that only accept a few of them.
+    // A KeySchema lists the keywords a function accepts, and only has pointers for those, so filling and clearing
+    // it is based on the size of the schema rather than the keyword set:
+    //
+    //      using DrawSchema = KeySchema<Keywords::Range,Keywords::Text>;
+    //
+    //      auto keys = pkw::FillKeySchema<DrawSchema>(args...);        // packed-parameter form
+    //      auto keys = kwx.FillKeySchema<DrawSchema>();                // streamed form
+    //
+    //      auto Range = ckw::Get(keys.Get<Keywords::Range>(),{0,0});
+    //
+    // In the packed-parameter form, passing a keyword that isn't in the schema is a compile error (static_assert), as
+    // is Get() for a keyword that isn't in the schema.  In the streamed form, the keywords aren't known until run-time, 
+    // so keywords not in the schema are ignored -- Map[] gives the schema index for each keyword (or -1) so that this 
+    // is one table lookup per keyword.
+    //
+    template<Keywords... keys>
+    struct KeySchema
+    {
+        static constexpr int Count = sizeof...(keys);
+
+        const void * pValues[Count ? Count : 1];        // Pointer to each keyword value, in schema order
+
+        static constexpr Keywords List[Count + 1] = { keys..., (Keywords) -1 };
+
+        // Index of a keyword in the schema, or -1 if it isn't in the schema
+
+        static constexpr int Find(Keywords key,int iIndex = 0) 
+        { 
+            return iIndex >= Count ? -1 : List[iIndex] == key ? iIndex : Find(key,iIndex + 1); 
+        }
+
+        struct __map { template<Keywords key> static constexpr int Entry() { return Find(key); } };
+
+        static constexpr const int (& Map)[KeywordCount] = KeyTable<__map,int>::values;
+
+        __forceinline void Clear() { for (int i=0;i<Count;i++) pValues[i] = nullptr; }
+
+        template<Keywords key>
+        __forceinline void Set(const typename KeyInfo<key>::type * pValue)
+        {
+            static_assert(Find(key) >= 0,"Keyword is not in this function's KeySchema");
+            pValues[Find(key)] = pValue;
+        }
+
+        // Add the keywords in a streamed list (keywords not in the schema are ignored)
+        //
+        void Fill(const ckw & kwx)
+        {
+            for (const ckw * pckw = &kwx; pckw; pckw = pckw->pNext)
+            {
+                if (!pckw->HasKey()) continue;
+
+                int iIndex = Map[(int) pckw->package.key];
+                if (iIndex >= 0) pValues[iIndex] = pckw->KeyData();
+            }
+        }
+
+        // Returns a pointer to the value, or nullptr if the keyword was not used (the same as KeyValuesPtr)
+        //
+        template<Keywords key>
+        __forceinline const typename KeyInfo<key>::type * Get() const
+        {
+            static_assert(Find(key) >= 0,"Keyword is not in this function's KeySchema");
+            return (const typename KeyInfo<key>::type *) pValues[Find(key)];
+        }
+    };
+
+    template<Keywords... keys> constexpr Keywords KeySchema<keys...>::List[];
+    template<Keywords... keys> constexpr const int (& KeySchema<keys...>::Map)[KeywordCount];
+
+    template<class Schema> 
+    inline Schema ckw::FillKeySchema() const
+    {
+        Schema schema;
+        schema.Clear();
+        schema.Fill(*this);
+        return schema;
+    }
+
+    // -----------------------------------------------
+    // KeyMapper -- resolve keywords into a user struct
+    // -----------------------------------------------
+    //
+    // Rather than getting each keyword with ckw::Get(keys.X,default), keywords can be copied directly into a 
+    // parameter struct, where the defaults are the struct's member initializers:
+    //
+    //      struct DrawBoxParams
+    //      {
+    //          std::array<int,2>   Range       = { 0, 0 };
+    //          const char        * Text        = nullptr;
+    //          bool                AddBorder   = false;
+    //
+    //          static void KeyMap(KeyMapper<DrawBoxParams> & map)
+    //          {
+    //              map.Bind<Keywords::Range>(&DrawBoxParams::Range);
+    //              map.Bind<Keywords::Text>(&DrawBoxParams::Text);
+    //              map.Bind<Keywords::AddBorder>(&DrawBoxParams::AddBorder);
+    //          }
+    //      };
+    //
+    //      auto params = kwx.Resolve<DrawBoxParams>();             // streamed form
+    //      auto params = pkw::Resolve<DrawBoxParams>(args...);     // packed-parameter form
+    //
+    // KeyMap() is called once per struct type to build a table of where each keyword goes in the struct, and each
+    // Resolve() is then one pass through the keywords, with one copy per keyword used.  Keywords not bound 
+    // in KeyMap() are ignored.
+    //
+    // Bind() checks that the member's type is the keyword's type.
+    //
+    template<class Params>
+    class KeyMapper
+    {
+        int m_iOffsets[KeywordCount];       // Offset of each keyword's member in Params, or -1 if not bound
+
+        KeyMapper()
+        {
+            for (int i=0;i<KeywordCount;i++) m_iOffsets[i] = -1;
+            Params::KeyMap(*this);
+        }
+
+    public:
+        template<Keywords key,class T>
+        void Bind(T Params::* pMember)
+        {
+            static_assert(std::is_same<T,typename KeyInfo<key>::type>::value,"KeyMapper member type does not match the keyword type");
+
+            Params stParams;
+            m_iOffsets[(int) key] = (int) ((const char *) &(stParams.*pMember) - (const char *) &stParams);
+        }
+
+        // The table for Params, built on first use
+        //
+        static const KeyMapper & Get() 
+        { 
+            static const KeyMapper mapper;
+            return mapper;
+        }
+
+        // Copy the keywords in a ckw list into Params
+        //
+        void Apply(Params & stParams,const ckw & kwx) const
+        {
+            for (const ckw * pckw = &kwx; pckw; pckw = pckw->pNext)
+            {
+                if (!pckw->HasKey()) continue;
+
+                int iKey    = (int) pckw->package.key;
+                int iOffset = m_iOffsets[iKey];
+
+                if (iOffset >= 0) memcpy((char *) &stParams + iOffset,pckw->KeyData(),KeySlots[iKey].size);
+            }
+        }
+    };
+
+    template<class Params> 
+    inline Params ckw::Resolve() const
+    {
+        Params stParams;
+        KeyMapper<Params>::Get().Apply(stParams,*this);
+        return stParams;
+    }
+
+    // -------------------------------------------
+    // KeyBound -- keywords bound to a function
+    // -------------------------------------------
+    //
+    // For a function called many times with the same keywords (i.e. in a loop), the keywords can be bound to it 
+    // once, so that each call only passes the positional arguments:
+    //
+    //      auto DrawRed = pkw::Bind(DrawBoxImpl,kw::Color="red",kw::Filled=true);  // or (kw::Color="red", ...).Bind(DrawBoxImpl)
+    //
+    //      for (int i=0;i<iCount;i++) DrawRed(x[i],y[i],r[i]);                     // calls DrawBoxImpl(x[i],y[i],r[i],keys)
+    //
+    // The function is called with the positional arguments followed by a const KeyValuesPtr &, i.e. the function
+    // behind a packed-parameter interface such as SomeFunction(const char *,const KeyValuesPtr &).  It can be a 
+    // function pointer or lambda (i.e. to call a member function).
+    //
+    // The keyword values are copied into a KeySnapshot held by the KeyBound object, and the KeyValuesPtr points into it, 
+    // so the keyword objects used to bind don't need to stay in scope -- but what they point to does (i.e. a string passed 
+    // as Text).  keylazy values are evaluated when they are bound.  The pointers are rebuilt when a KeyBound is copied.
+    //
+    template<class F>
+    class KeyBound
+    {
+        F               m_fFunc;
+        KeySnapshot     m_snapshot;
+        KeyValuesPtr    m_keys;         // Points to the values in m_snapshot
+
+    public:
+        KeyBound(const F & fFunc,const KeySnapshot & snapshot) : m_fFunc(fFunc), m_snapshot(snapshot), m_keys(m_snapshot.FillKeyValues()) 
+        { 
+            m_snapshot.Evaluate();      // (keylazy values, in place -- m_keys still points to them)
+        }
+        KeyBound(const KeyBound & p2) : m_fFunc(p2.m_fFunc), m_snapshot(p2.m_snapshot), m_keys(m_snapshot.FillKeyValues()) { }
+
+        KeyBound & operator = (const KeyBound &) = delete;
+
+        // The bound keywords, as passed to the function
+        //
+        __forceinline const KeyValuesPtr & Keys() const { return m_keys; }
+
+        template<class... Args>
+        __forceinline auto operator () (Args&&... args) const 
+            -> decltype(std::declval<const F &>()(std::forward<Args>(args)...,std::declval<const KeyValuesPtr &>()))
+        {
+            return m_fFunc(std::forward<Args>(args)...,m_keys);
+        }
+    };
+
+    template<class F> 
+    inline KeyBound<typename std::decay<F>::type> ckw::Bind(const F & fFunc) const
+    {
+        return KeyBound<typename std::decay<F>::type>(fFunc,FillKeySnapshot());
+    }
+
+#ifdef keyword_cpp17_support
+
+    // ---------------------------------------------------
+    // KeyPreset -- owned keyword values (std::pmr memory)
+    // ---------------------------------------------------
+    //
+    // For keyword sets that are kept (i.e. presets), KeyPreset owns a copy of the values, allocated from a 
+    // std::pmr::memory_resource -- i.e. a std::pmr::monotonic_buffer_resource per frame, so building presets doesn't 
+    // use the global allocator.  The values are packed the same as KeyFrozen, in one allocation, with no fixed size.
+    //
+    // Unlike KeyFrozen, text values (const char * keywords) are copied into the same allocation, so the preset 
+    // doesn't depend on the strings passed to it:
+    //
+    //      std::pmr::monotonic_buffer_resource arena(stBuffer,sizeof(stBuffer));
+    //
+    //      KeyPreset preset((kw::Text="Hello", kw::BorderSize=10),&arena);     // or pkw::Preset(&arena,args...)
+    //      auto keys = preset.FillKeyValues();
+    //
+    // As with std::pmr containers, a copy is allocated from the default memory resource, unless one is given, i.e. to
+    // keep a preset made in a per-frame arena after the arena is released:
+    //
+    //      KeyPreset keep(preset,pLongLivedResource);
+    //
+    // Moves keep the memory resource of the object moved from, and assignment keeps the memory resource of the object 
+    // assigned to.
+    //
+    struct __keyistext { template<Keywords key> static constexpr bool Entry() { return std::is_same<typename KeyInfo<key>::type,const char *>::value; } };
+
+    inline constexpr const bool (& KeyIsText)[KeywordCount] = KeyTable<__keyistext,bool>::values;
+
+    class KeyPreset
+    {
+        std::pmr::memory_resource * m_pResource;
+        KeyMask                     m_keyMask{};
+        unsigned char             * m_pData     = nullptr;
+        std::size_t                 m_iBytes    = 0;
+
+        void Free()
+        {
+            if (m_pData) m_pResource->deallocate(m_pData,m_iBytes,KeyMaxAlign);
+
+            m_pData   = nullptr;
+            m_iBytes  = 0;
+            m_keyMask = KeyMask{};
+        }
+
+        // Allocate and copy the values in the snapshot, with text after the values 
+        //
+        void Copy(const KeySnapshot & snapshot)
+        {
+            std::size_t iOffset = 0;
+            std::size_t iText   = 0;
+
+            for (int i=0;i<KeywordCount;i++)
+            {
+                if (!snapshot.keyMask.Has((Keywords) i)) continue;
+
+                iOffset = KeyPackOffset(iOffset,KeySlots[i]) + KeySlots[i].size;
+                if (KeyIsText[i]) 
+                {
+                    const char * sText = *(const char * const *) ((const char *) &snapshot.values + KeySlots[i].structOffset);
+                    if (sText) iText += strlen(sText) + 1;
+                }
+            }
+
+            m_keyMask = snapshot.keyMask;
+            m_iBytes  = iOffset + iText;
+            if (!m_iBytes) return;
+
+            m_pData = (unsigned char *) m_pResource->allocate(m_iBytes,KeyMaxAlign);
+
+            char * pText = (char *) m_pData + iOffset;
+            iOffset = 0;
+
+            for (int i=0;i<KeywordCount;i++)
+            {
+                if (!m_keyMask.Has((Keywords) i)) continue;
+
+                iOffset = KeyPackOffset(iOffset,KeySlots[i]);
+                memcpy(m_pData + iOffset,(const char *) &snapshot.values + KeySlots[i].structOffset,KeySlots[i].size);
+                KeyEvaluate(i,m_pData + iOffset);
+
+                if (KeyIsText[i])
+                {
+                    const char * sText;
+                    memcpy(&sText,m_pData + iOffset,sizeof(sText));
+
+                    if (sText)
+                    {
+                        std::size_t iLength = strlen(sText) + 1;
+                        memcpy(pText,sText,iLength);
+                        memcpy(m_pData + iOffset,&pText,sizeof(pText));
+                        pText += iLength;
+                    }
+                }
+                iOffset += KeySlots[i].size;
+            }
+        }
+
+    public:
+        explicit KeyPreset(std::pmr::memory_resource * pResource = std::pmr::get_default_resource()) : m_pResource(pResource) { }
+
+        KeyPreset(const KeySnapshot & snapshot,std::pmr::memory_resource * pResource = std::pmr::get_default_resource()) 
+            : m_pResource(pResource) { Copy(snapshot); }
+
+        KeyPreset(const ckw & kwx,std::pmr::memory_resource * pResource = std::pmr::get_default_resource()) 
+            : m_pResource(pResource) { Copy(kwx.FillKeySnapshot()); }
+
+        KeyPreset(const KeyPreset & p2) : KeyPreset(p2,std::pmr::get_default_resource()) { }
+
+        KeyPreset(const KeyPreset & p2,std::pmr::memory_resource * pResource) : m_pResource(pResource) { Copy(p2.Snapshot()); }
+
+        KeyPreset(KeyPreset && p2) noexcept : m_pResource(p2.m_pResource), m_keyMask(p2.m_keyMask), m_pData(p2.m_pData), m_iBytes(p2.m_iBytes)
+        {
+            p2.m_pData   = nullptr;
+            p2.m_iBytes  = 0;
+            p2.m_keyMask = KeyMask{};
+        }
+
+        KeyPreset & operator = (const KeyPreset & p2)
+        {
+            if (this != &p2) 
+            { 
+                KeySnapshot snapshot = p2.Snapshot();   // (text still points to p2 until copied)
+                Free(); 
+                Copy(snapshot); 
+            }
+            return *this;
+        }
+
+        KeyPreset & operator = (KeyPreset && p2)
+        {
+            if (this == &p2) return *this;
+            if (*m_pResource != *p2.m_pResource) return operator = ((const KeyPreset &) p2);
+
+            Free();
+            m_keyMask  = p2.m_keyMask;
+            m_pData    = p2.m_pData;
+            m_iBytes   = p2.m_iBytes;
+            p2.m_pData   = nullptr;
+            p2.m_iBytes  = 0;
+            p2.m_keyMask = KeyMask{};
+            return *this;
+        }
+
+        ~KeyPreset() { Free(); }
+
+        // Returns a KeyValuesPtr pointing to the values in this preset
+        //
+        __forceinline const KeyValuesPtr FillKeyValues() const { return KeyPacked(m_keyMask,m_pData); }
+
+        // Returns a copy of the values (text values point to this preset's copy of the text)
+        //
+        KeySnapshot Snapshot() const
+        {
+            KeySnapshot snapshot;
+            snapshot.keyMask = m_keyMask;
+
+            const KeyValuesPtr kValues = FillKeyValues();
+            for (int i=0;i<KeywordCount;i++)
+            {
+                if (!m_keyMask.Has((Keywords) i)) continue;
+
+                const void * pValue;
+                memcpy(&pValue,(const char *) &kValues + KeySlots[i].ptrOffset,sizeof(pValue));
+                memcpy((char *) &snapshot.values + KeySlots[i].structOffset,pValue,KeySlots[i].size);
+            }
+            return snapshot;
+        }
+
+        __forceinline std::pmr::memory_resource * Resource() const { return m_pResource; }
+    };
+
+#endif // keyword_cpp17_support
+
     // ---------=---------------------------------
     // CKwargs Packed-Parameter Fill Keyword Class
     // -------------------------------------------
@@ -360,23 +1876,82 @@ namespace ckwargs
 
         // Parameter Pack Templates for retrieving keyword pointers 
        
-        static void __fillkeyvalues(ckw & ckwOrg) { ckwOrg; }
+        // Typed keyword (i.e. ckwkey) -- the slot is known at compile-time, so this is a single pointer store.
+        //
+        template <Keywords key>
+        static __forceinline void __fillkeyvalue(KeyValuesPtr & kValues,const ckwkey<key> & kwx)
+        {
+            KeyInfo<key>::Slot(kValues) = const_cast<typename KeyInfo<key>::type *>(&kwx.value);
+            kValues.keyMask.Set(key);
+        }
 
-        // Original incoming ckw class is an empty object with no keyword.
+        // Untyped ckw object (i.e. streamed keywords sent as one argument) -- look it up through the 
+        // ckw linked list.
         //
-        template <class... Args>
-        static void __fillkeyvalues(ckw & ckwOrg,const ckw & kwx,const Args&... args)
+        static __forceinline void __fillkeyvalue(KeyValuesPtr & kValues,const ckw & kwx) { kwx.FillKeyValues(kValues); }
+
+        // KeySnapshot versions of the above -- values are copied rather than pointed to.
+        //
+        template <Keywords key>
+        static __forceinline void __fillkeyvalue(KeySnapshot & snapshot,const ckwkey<key> & kwx)
+        {
+            KeyInfo<key>::Field(snapshot.values) = kwx.value;
+            snapshot.keyMask.Set(key);
+        }
+
+        static __forceinline void __fillkeyvalue(KeySnapshot & snapshot,const ckw & kwx) { kwx.FillKeySnapshot(snapshot); }
+
+        // KeyValuesSparse versions
+        //
+        template <Keywords key>
+        static __forceinline void __fillkeyvalue(KeyValuesSparse & kValues,const ckwkey<key> & kwx)
         {
-            ckwOrg << kwx;      // Link the current argument/parameter to the previous one.
-            __fillkeyvalues(ckwOrg,args...);
+            kValues.Set(key,&kwx.value);
         }
 
+        static __forceinline void __fillkeyvalue(KeyValuesSparse & kValues,const ckw & kwx) { kwx.FillKeySparse(kValues); }
+
+        // KeySchema versions -- a typed keyword that isn't in the schema is a compile error (see KeySchema::Set())
+        //
+        template <Keywords key,Keywords... keys>
+        static __forceinline void __fillkeyvalue(KeySchema<keys...> & schema,const ckwkey<key> & kwx) { schema.template Set<key>(&kwx.value); }
+
+        template <Keywords... keys>
+        static __forceinline void __fillkeyvalue(KeySchema<keys...> & schema,const ckw & kwx) { schema.Fill(kwx); }
+
+#ifdef keyword_cpp17_support
+
+        // C++17 -- one fold expression stores every argument, so there is a single instantiation per call
+        // signature rather than one nested instantiation per argument.  The comma fold is evaluated left-to-right,
+        // so the last of any repeated keyword still wins.
+        //
+        template <class Fill,class... Args>
+        static __forceinline void __fillkeyvalues(Fill & kValues,const Args&... args)
+        {
+            (void) kValues;     // (unused when there are no arguments)
+            (__fillkeyvalue(kValues,args), ...);
+        }
+#else
+        template <class Fill>
+        static void __fillkeyvalues(Fill & kValues) { (void) kValues; }
+
+        template <class Fill,class Arg,class... Args>
+        static __forceinline void __fillkeyvalues(Fill & kValues,const Arg & kwx,const Args&... args)
+        {
+            __fillkeyvalue(kValues,kwx);       // Store the current argument/parameter
+            __fillkeyvalues(kValues,args...);
+        }
+#endif
+
     public:
-        // FillKeyValues -- Take a packed parameter package and link the values together as a ckw class,
-        // returning a KeyValuePtr object with keyword pointers
+        // FillKeyValues -- Take a packed parameter package and return a KeyValuesPtr object with keyword pointers
         //
         // At this point, the packed-parameters are out of the equation and we can just deal with the keywords.
         //
+        // Each argument is stored directly in its KeyValuesPtr slot -- the ckw objects are not linked together, 
+        // and the keyword for each typed argument is resolved at compile-time.  As with the streamed version, 
+        // if a keyword is used more than once, the last one wins.
+        //
         // The return value is KeyValuesPtr.  
         // A return cwk object would have made things more consistent with the packed-parameters vs. streamed parameters,
         // but would have caused a copy of the cwk object, so it returns KeyValuesPtr, since that's the
@@ -385,19 +1960,110 @@ namespace ckwargs
         template <class... Args>
         static KeyValuesPtr FillKeyValues(const Args&... args)
         {
-            ckw kwx;                            // Get an empty object
-            __fillkeyvalues(kwx,args...);       // Compile our ckw object
-            return kwx.FillKeyValues();         // Get all keyword information and return it.
+            KeyValuesPtr kValues{};             // Initialize all pointers to nullptr
+            __fillkeyvalues(kValues,args...);   // Store pointers for the keywords used
+            return kValues;
         }
 
         // FillKeyValues() for empty keyword sections (i.e. no keywords specified)
         //
-        static KeyValuesPtr FillKeyValues() { ckw kwx; return kwx.FillKeyValues(); }
+        static KeyValuesPtr FillKeyValues() { return KeyValuesPtr{}; }
+
+        // Has<Keywords::X,Args...>::value -- true if keyword X is in the argument types (see KeySignature above)
+        //
+        template<Keywords key,class... Args> 
+        using Has = KeyHas<key,Args...>;
+
+        // Signature -- returns the KeySignature for the arguments, to pass on to a template implementation function
+        // (see KeySignature above).  The arguments are only used for their types.
+        //
+        template <class... Args>
+        static constexpr KeySignatureOf<Args...> Signature(const Args&...) { return KeySignatureOf<Args...>{}; }
+
+        // FillKeySnapshot -- Same as FillKeyValues(), but copies the values of the keywords used into 
+        // a KeySnapshot (see KeySnapshot, above).
+        //
+        template <class... Args>
+        static KeySnapshot FillKeySnapshot(const Args&... args)
+        {
+            KeySnapshot snapshot;
+            snapshot.keyMask = KeyMask{};
+            __fillkeyvalues(snapshot,args...);
+            return snapshot;
+        }
+
+        // FillKeySparse -- Same as FillKeyValues(), but returns a KeyValuesSparse, which only holds 
+        // the keywords used (see KeyValuesSparse, above).
+        //
+        template <class... Args>
+        static KeyValuesSparse FillKeySparse(const Args&... args)
+        {
+            static_assert(sizeof...(Args) <= keyword_sparse_max,"More keywords than keyword_sparse_max -- increase keyword_sparse_max");
+
+            KeyValuesSparse kValues;
+            kValues.Clear();
+            __fillkeyvalues(kValues,args...);
+            return kValues;
+        }
+
+        // Resolve -- Returns a user parameter struct with the keywords used copied into it (see KeyMapper, above).
+        // 
+        // Each argument is applied in order, so the last of any repeated keyword wins.
+        //
+        template <class Params,class... Args>
+        static Params Resolve(const Args&... args)
+        {
+            Params stParams;
+            const KeyMapper<Params> & mapper = KeyMapper<Params>::Get();
+
+            int iDummy[] = { 0, (mapper.Apply(stParams,args),0)... };
+            (void) iDummy; (void) mapper;
+            return stParams;
+        }
+
+        // Bind -- Binds the keywords to a function, returning a callable that can be called many times with only 
+        // the positional arguments (see KeyBound, above)
+        //
+        template <class F,class... Args>
+        static KeyBound<typename std::decay<F>::type> Bind(const F & fFunc,const Args&... args)
+        {
+            return KeyBound<typename std::decay<F>::type>(fFunc,FillKeySnapshot(args...));
+        }
+
+        // Capture -- Copies the keyword values into a self-contained KeyFrozen (see KeyFrozen, above)
+        //
+        template <class... Args>
+        static KeyFrozen Capture(const Args&... args) { return KeyFrozen(FillKeySnapshot(args...)); }
+
+#ifdef keyword_cpp17_support
+
+        // Preset -- Copies the keyword values into a KeyPreset, allocated from a std::pmr::memory_resource 
+        // (see KeyPreset, above)
+        //
+        template <class... Args>
+        static KeyPreset Preset(std::pmr::memory_resource * pResource,const Args&... args) { return KeyPreset(FillKeySnapshot(args...),pResource); }
+#endif
+
+        // FillKeySchema -- Same as FillKeyValues(), but returns a KeySchema, which only holds the keywords 
+        // the function accepts (see KeySchema, above)
+        //
+        template <class Schema,class... Args>
+        static Schema FillKeySchema(const Args&... args)
+        {
+            Schema schema;
+            schema.Clear();
+            __fillkeyvalues(schema,args...);
+            return schema;
+        }
 
     }; // class pkw
 
 } // namespace ckwargs
 
+#ifdef keyword_header_only
+#include "ckwargs_inline.h"         // ckwargs.cpp code, compiled inline
+#endif
+
 #ifdef _MSC_VER 
 #pragma warning( pop )
 #endif
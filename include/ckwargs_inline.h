@@ -0,0 +1,177 @@
+#pragma once
+
+// ----------------------------------------------------------------
+// CKwargs -- Sagebox C++ Named Parameter and Named Functions Class 
+// ----------------------------------------------------------------
+//
+// Copyright (c) 2022 Rob Nelson, All Rights Reserved. Released under MIT License.  rob@sagebox.org
+//
+// ---------------------------------------------
+// ckwargs_inline.h -- ckw class out-of-line code
+// ---------------------------------------------
+//
+// This is the code for ckwargs.cpp (see ckwargs.cpp for a description).  It is kept in this file so that it can 
+// be compiled either way:
+//
+//    1. Normally, it is included by ckwargs.cpp and compiled once, as with any other .cpp file.
+//
+//    2. With keyword_header_only defined (see ckwargs.h), it is included by ckwargs.h and the functions are 
+//       declared inline, so the compiler can see through FillKeyValues() at the call site without 
+//       link-time optimization -- i.e. it can tell which keywords were set and fold constant values into 
+//       the function using them.  ckwargs.cpp then compiles to nothing and doesn't need to be in the project.
+//
+// This file is not meant to be included directly.
+
+#include <cstring>
+
+namespace ckwargs      // namespace name is arbitrary
+{
+    // FillKeyValues() -- Go through compiled, ckw class linked list
+    // and save pointer to values of used keywords (otherwise pointers are nullptr)
+    //
+    // note: This is the ckw class version.  The ckwargs version for packed parameters
+    //       (that then calls this version) is in ckwargs.h
+    //
+    _ckwargs_inline const KeyValuesPtr ckw::FillKeyValues() const
+    {
+        KeyValuesPtr kValues{};     // Initialize all pointers to nullptr
+
+        FillKeyValues(kValues);
+        return kValues;
+    }
+
+    // FillKeyValues() -- version that fills the caller's KeyValuesPtr
+    //
+    // This is also used by the packed-parameter version for ckw objects that are passed as 
+    // an untyped ckw (i.e. a streamed list passed as one argument)
+    //
+    _ckwargs_inline void ckw::FillKeyValues(KeyValuesPtr & kValues) const
+    {
+        const ckw * pckw = this;    // Start at the top (by definition, we call with the top-level
+                                    // ckw class object)
+
+        // Go through the linked list and save any pointers we find.
+        //
+        // The location of each keyword comes from the KeySlots table (see my_keydefs.h), so there is
+        // one store per keyword, without a switch statement.
+
+        while (pckw)
+        {
+            if (pckw->HasKey())
+            {
+                auto key            = pckw->package.key;
+                const void * pValue = pckw->KeyData();
+
+                memcpy((char *) &kValues + KeySlots[(int) key].ptrOffset,&pValue,sizeof(pValue));
+                kValues.keyMask.Set(key);
+            }
+            pckw = pckw->pNext;
+        }
+    }
+
+    // FillKeyValues() -- KeyCache version
+    //
+    // The list is checked against the cached signature while the pointers are stored, so a hit is one pass
+    // through the list.  On a miss (including partway through the list), the KeyValuesPtr is rebuilt and the new
+    // signature is saved.
+    //
+    _ckwargs_inline const KeyValuesPtr & ckw::FillKeyValues(KeyCache & cache) const
+    {
+        KeyValuesPtr & kValues = cache.kValues;
+
+        bool bHit   = cache.count >= 0;
+        int  iCount = 0;
+
+        for (const ckw * pckw = this; pckw && bHit; pckw = pckw->pNext)
+        {
+            if (!pckw->HasKey()) continue;
+
+            auto key = pckw->package.key;
+            if (iCount >= cache.count || cache.keys[iCount] != key) { bHit = false; break; }
+
+            const void * pValue = pckw->KeyData();
+            memcpy((char *) &kValues + KeySlots[(int) key].ptrOffset,&pValue,sizeof(pValue));
+            iCount++;
+        }
+
+        if (bHit && iCount == cache.count)
+        {
+            cache.hits++;
+            return kValues;
+        }
+
+        // Miss -- rebuild the pointers and save the new signature
+
+        cache.misses++;
+        kValues = KeyValuesPtr{};
+        FillKeyValues(kValues);
+
+        cache.count = 0;
+        for (const ckw * pckw = this; pckw; pckw = pckw->pNext)
+        {
+            if (!pckw->HasKey()) continue;
+            if (cache.count == keyword_cache_max) { cache.count = -1; break; }    // Too many to cache
+            
+            cache.keys[cache.count++] = pckw->package.key;
+        }
+
+        return kValues;
+    }
+
+    // FillKeySnapshot() -- Go through the linked list and copy the values of used keywords
+    // into the snapshot, setting keyMask for each one.
+    //
+    // As with FillKeyValues(KeyValuesPtr &), the second version adds to the snapshot passed in, so 
+    // keyMask must be cleared by the caller.
+    //
+    _ckwargs_inline const KeySnapshot ckw::FillKeySnapshot() const
+    {
+        KeySnapshot snapshot;
+
+        snapshot.keyMask = KeyMask{};
+        FillKeySnapshot(snapshot);
+        return snapshot;
+    }
+
+    _ckwargs_inline void ckw::FillKeySnapshot(KeySnapshot & snapshot) const
+    {
+        const ckw * pckw = this;
+
+        while (pckw)
+        {
+            if (pckw->HasKey())
+            {
+                auto key             = pckw->package.key;
+                const KeySlot & slot = KeySlots[(int) key];
+
+                memcpy((char *) &snapshot.values + slot.structOffset,pckw->KeyData(),slot.size);
+                snapshot.keyMask.Set(key);
+            }
+            pckw = pckw->pNext;
+        }
+    }
+
+    // FillKeySparse() -- Go through the linked list and add pointers for used keywords to the
+    // KeyValuesSparse list
+    //
+    _ckwargs_inline const KeyValuesSparse ckw::FillKeySparse() const
+    {
+        KeyValuesSparse kValues;
+
+        kValues.Clear();
+        FillKeySparse(kValues);
+        return kValues;
+    }
+
+    _ckwargs_inline void ckw::FillKeySparse(KeyValuesSparse & kValues) const
+    {
+        const ckw * pckw = this;
+
+        while (pckw)
+        {
+            if (pckw->HasKey()) kValues.Set(pckw->package.key,pckw->KeyData());
+            pckw = pckw->pNext;
+        }
+    }
+
+} // namespace ckwargs
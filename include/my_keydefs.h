@@ -4,8 +4,8 @@
 // Example keyword definitions
 // ---------------------------
 
-// Fill in the macros below for keyword name and keyword type.
-// This sample file has 4 entries as examples.
+// Fill in the _ckwargs_Keywords list below with the keyword names and keyword types.
+// This sample file has 6 entries as examples.
 
 // --> Using Multiple Keywords Sets in the Same Program
 // 
@@ -13,13 +13,11 @@
 //     they become global macros, hence the "_ckwargs_" prefix to make them unique. 
 //
 //     For programs that want to use multiple keyword sets, 
-//     the first 4 #defines will need to be unique, such as basing the prefix on the namespace for each keyword set.
+//     the _ckwargs_Keywords #define will need to be unique, such as basing the prefix on the namespace for each keyword set.
+//     It is only expanded in this file -- ckwargs.h uses what is generated here (i.e. KeySlots, KeyInfo and KeyList), 
+//     so the expansions below are the only places the name needs to be changed.
 //
-//     Another option is to remove the #defines (nothing else exposed but the first 4 #defines below)
-//     and add each keyword name for each of the 4 sections where they are used.
-// 
-//     The using statements and CheckItem macros are not exposed pubilicy and don't need to be changed for 
-//     other keywords sets.
+//     The using statements and the helper macros below it don't need to be changed for other keywords sets.
 //
 
 // For a program to use functions using cwargs, it only needs to include the single my_keywords.h/my_keyfuncs.h, depending on the
@@ -28,56 +26,73 @@
 namespace ckwargs
 {
 
-// define the keyword names used.  These are not the keywords used by the user (these come from my_keywordsh and/or my_keyfuncs.h).
-// The keys below are used by the functions using the keywords as symblic names such as key.Range, key.Text, etc.
-
-#define _ckwargs_key1 Range                  // Example Range keyword or function, i.e. Range = {5,10} or Range(5,10)
-#define _ckwargs_key2 Text                   // i.e. Text = "Hello World" or Text("Hello World")
-#define _ckwargs_key3 BorderSize             // i.e. BorderSize = 10, or BorderSize(10)
-#define _ckwargs_key4 AddBorder              // i.e. AddBorder = true, AddBorder = false, or AddBorder() or AddBorder(true) or AddBorder(false)
-
+// -------------------
+// Keyword definitions
+// -------------------
+//
+// Define the keyword names, defaults and types used -- one line per keyword, as _key(name, (default), type).  
+// 
+// The names are not the keywords used by the user (these come from my_keywordsh and/or my_keyfuncs.h).
+// The names below are used by the functions using the keywords as symblic names such as key.Range, key.Text, etc.
+//
+// The default is the value used by Resolved() when the keyword isn't passed (see KeyDefaults below).  It is in 
+// parentheses so that it can contain commas, i.e. ({0,0}).
+//
+// The type is last so that it can contain commas, i.e. std::array<int,2>.  Note that for this example, <array> 
+// is included in ckwargs.h to define array for use here.
+//
+// This is the only list that needs to be maintained -- Keywords, KeyValuesPtr, KeyValuesStruct, KeySlots, 
+// KeyInfo and KeyDefaults below are all generated from it, for any number of keywords.
+//
+// Types must be trivially copyable.  It's recommended to use pointers as the input for the keywords for class objects,
+// or keyref<T> for large objects, which keeps the Keyword=value syntax but passes the object by reference (see Palette).
+// keylazy<T> keywords take a callable that is only called if the function reads the keyword (see TextExtent) -- their 
+// default is given as the value, i.e. ({0,0}).
+
+#define _ckwargs_Keywords(_key)                                                                                                  \
+                                                                                                                                 \
+    _key(Range          , ({0,0})   , std::array<int,2> )   /* i.e. Range = {5,10} or Range(5,10)                                       */   \
+    _key(Text           , (nullptr) , const char *      )   /* i.e. Text = "Hello World" or Text("Hello World")                         */   \
+    _key(BorderSize     , (0)       , int               )   /* i.e. BorderSize = 10, or BorderSize(10)                                  */   \
+    _key(AddBorder      , (false)   , bool              )   /* i.e. AddBorder = true, AddBorder = false, or AddBorder() or AddBorder(true)  */   \
+    _key(Palette        , (nullptr) , keyref<std::array<unsigned int,256>> )   /* i.e. Palette = szPalette (by reference, see keyref in ckwargs.h) */   \
+    _key(TextExtent     , ({0,0})   , keylazy<std::array<int,2>> )   /* i.e. TextExtent = [&]{ return Measure(sText); } (see keylazy in ckwargs.h) */
 
-// Set the type for each keyword. Note that for this example, <array> is included in ckwargs.h to define array for use here.
+    
+// These sections don't need to be changed for keywords -- each one expands the list above. 
 
-using  _ckwargs_type1 = std::array<int,2>    ;   // i.e. std::array<int,2> Range, etc.
-using  _ckwargs_type2 = const char *         ;   // i.e. const char * Text
-using  _ckwargs_type3 = int                  ;   // i.e. int BoderSize
-using  _ckwargs_type4 = bool                 ;   // i.e. bool AddBorder
+    #define _ckwargs_DefKey(_x,_def,...)         _x,
+    #define _ckwargs_DefCount(_x,_def,...)       + 1
+    #define _ckwargs_DefValue(_x,_def,...)       __VA_ARGS__ _x;
+    #define _ckwargs_DefValuePtr(_x,_def,...)    __VA_ARGS__ * _x;
 
-    
-// These sections don't need to be changed for keywords, but need to have the same number of entries as keywords defined above. 
+    #define _ckwargs_Strip(...)                  __VA_ARGS__        // Removes the parentheses from a default value
 
     enum class Keywords 
     {   
-        _ckwargs_key1, 
-        _ckwargs_key2, 
-        _ckwargs_key3, 
-        _ckwargs_key4, 
+        _ckwargs_Keywords(_ckwargs_DefKey)
     };
 
-#ifdef _ckwargs_inc_check_items // Limit exposure to _kw_CheckItems macro so we can re-use it with multiple ckwargs modules
-                                // (i.e. this #define never needs to be changed for multiple ckwargs uses in the same module)
+    _ckwargs_constexpr int KeywordCount = 0 _ckwargs_Keywords(_ckwargs_DefCount);      // Number of keywords above
 
-    #define _ckwargs_CheckItems     CheckItem(_ckwargs_key1    );    \
-                                    CheckItem(_ckwargs_key2    );    \
-                                    CheckItem(_ckwargs_key3    );    \
-                                    CheckItem(_ckwargs_key4    );
+    // Presence bitmask, with one bit per keyword (see KeyMaskT in ckwargs.h)
 
-#endif
-    // -----------------
-    // Key Value storage
-    // -----------------
-    //  
-    // This is currently set as a union.  It can be a struct to allow container items with constructors/destructors/etc., but
-    // is not recommended.  It's recommended to use references as the input for the keywords for class objects. 
-    
-    union KeyValues     // Optionally a struct for more flexibility (and headaches)
-    {
-        _ckwargs_type1         _ckwargs_key1 ;
-        _ckwargs_type2         _ckwargs_key2 ;    
-        _ckwargs_type3         _ckwargs_key3 ;
-        _ckwargs_type4         _ckwargs_key4 ;
-    };
+    using KeyMask = KeyMaskT<Keywords,KeywordCount>;
+
+    // -------
+    // KeyList
+    // -------
+    //
+    // All keywords as a template parameter pack, for the tables ckwargs.h builds with one entry per keyword (i.e. 
+    // KeySignatureOf, KeySchema::Map -- see KeyTable in ckwargs.h), so that ckwargs.h doesn't expand the list above itself.
+    //
+    // KeyList<T,Pre...> is T<Pre..., void, std::integral_constant<Keywords,Keywords::Range>, ...> -- the void absorbs 
+    // the first ',' from the expansion.
+
+    #define _ckwargs_DefKeyList(_x,_def,...) , std::integral_constant<Keywords,Keywords::_x>
+
+    template<template<class...> class T,class... Pre>
+    using KeyList = T<Pre...,void _ckwargs_Keywords(_ckwargs_DefKeyList)>;
 
     // ------------
     // KeyValuesPtr
@@ -86,15 +101,119 @@ using  _ckwargs_type4 = bool                 ;   // i.e. bool AddBorder
     // Used when calling KillKeyValues() and not part of the keyword class (i.e. it's put on the stack of the function using
     // the keywords)
     //  
-    // This is the exact format as KeyValues, but as pointers.  
+    // This has a pointer to the value of each keyword used, or nullptr for keywords that weren't used.  
+    //
+    // keyMask has a bit set for each keyword that was used, so a function can check for
+    // keywords with one compare, i.e. !keys.keyMask.Any() or keys.keyMask == KeyMask::Of<Keywords::Range>()
     //
      // See the Get() functions for shortcuts on retrieving values.
     //
+    template<Keywords key> struct KeyInfo;
+
     struct KeyValuesPtr
     {
-        _ckwargs_type1  * _ckwargs_key1 ;
-        _ckwargs_type2  * _ckwargs_key2 ;
-        _ckwargs_type3  * _ckwargs_key3 ;
-        _ckwargs_type4  * _ckwargs_key4 ;
+        _ckwargs_Keywords(_ckwargs_DefValuePtr)
+
+        KeyMask keyMask;
+
+        // Returns the keyword value, or its default (see KeyDefaults below) if it wasn't used, without a branch
+        //
+        // (for keylazy keywords, this is the evaluated value -- see KeyResolved in ckwargs.h)
+        //
+        template<Keywords key> 
+        typename KeyInfo<key>::resolved Resolved() const;
     };
-} // namespace ckwargs
\ No newline at end of file
+
+    // ---------------
+    // KeyValuesStruct
+    // ---------------
+    //
+    // All keyword values in one struct, so that all keyword values can be held at once.
+    // This is used by KeySnapshot (see ckwargs.h) to copy the keywords used into one contiguous block.
+    //
+    struct KeyValuesStruct
+    {
+        _ckwargs_Keywords(_ckwargs_DefValue)
+    };
+
+    // --------
+    // KeySlots
+    // --------
+    //
+    // Table of where each keyword lives in KeyValuesPtr, KeyValuesStruct and its ckwkey object, indexed by the Keywords value.
+    //
+    // ckw::FillKeyValues() and ckw::FillKeySnapshot() use this to store each keyword with one indexed store, rather than 
+    // a switch with a case for each keyword, so the code is the same size regardless of the number of keywords.
+    //
+    // (_ckwargs_table in ckwargs.h defines the table so that it's one object shared by all source files)
+
+    #define _ckwargs_DefKeySlot(_x,_def,...) { offsetof(KeyValuesPtr,_x), offsetof(KeyValuesStruct,_x), sizeof(KeyValuesStruct::_x), KeyNodeOffset(alignof(__VA_ARGS__)), alignof(__VA_ARGS__) },
+
+    _ckwargs_table(KeySlot,KeySlots,KeywordCount,_ckwargs_Keywords(_ckwargs_DefKeySlot))
+
+    // -------
+    // KeyInfo
+    // -------
+    //
+    // Compile-time information for each keyword: its index, storage type, size and alignment, and where it lives 
+    // in KeyValuesPtr and KeyValuesStruct.
+    // 
+    // This is used by the packed-parameter FillKeyValues() to resolve typed keywords (see ckwkey in ckwargs.h) 
+    // when the template is instantiated, rather than looking them up at run-time.
+
+    #define _ckwargs_DefKeyInfo(_x,_def,...) template<> struct KeyInfo<Keywords::_x>                                                    \
+                                        {                                                                                               \
+                                            using type = __VA_ARGS__;                                                                   \
+                                            using value    = typename KeyResolved<type>::value;    /* see KeyResolved in ckwargs.h */  \
+                                            using resolved = typename KeyResolved<type>::type;                                          \
+                                                                                                                                        \
+                                            static constexpr int         index = (int) Keywords::_x;                                    \
+                                            static constexpr std::size_t size  = sizeof(type);                                          \
+                                            static constexpr std::size_t align = alignof(type);                                         \
+                                            static constexpr std::size_t offset = KeyNodeOffset(align);     /* in ckwkey */             \
+                                                                                                                                        \
+                                            static_assert(std::is_trivially_copyable<type>::value,"Keyword types must be trivially copyable"); \
+                                                                                                                                        \
+                                            static constexpr type Default() { return KeyResolved<type>::Default({ _ckwargs_Strip _def }); } \
+                                                                                                                                        \
+                                            static __forceinline type * & Slot(KeyValuesPtr & kValues)               { return kValues._x; } \
+                                            static __forceinline type *   Slot(const KeyValuesPtr & kValues)         { return kValues._x; } \
+                                            static __forceinline type   & Field(KeyValuesStruct & kValues)           { return kValues._x; } \
+                                            static __forceinline const type & Field(const KeyValuesStruct & kValues) { return kValues._x; } \
+                                        };
+
+    _ckwargs_Keywords(_ckwargs_DefKeyInfo)
+
+    // -----------
+    // KeyDefaults
+    // -----------
+    //
+    // The default value of each keyword (from the list above), as one constant KeyValuesStruct.  
+    //
+    // Resolved() selects between the keyword pointer and the default's address by indexing with the keyMask bit, so
+    // reading a keyword with its default is a load, with no branch and no default argument at the call site:
+    //
+    //      auto iBorderSize = keys.Resolved<Keywords::BorderSize>();
+    //
+    // (KeyDefaultsT is a template only so that its static member can be defined in this header for C++11)
+
+    #define _ckwargs_DefDefault(_x,_def,...) KeyInfo<Keywords::_x>::Default(),
+
+    template<class T = void>
+    struct KeyDefaultsT
+    {
+        static constexpr KeyValuesStruct values = { _ckwargs_Keywords(_ckwargs_DefDefault) };
+    };
+
+    template<class T> constexpr KeyValuesStruct KeyDefaultsT<T>::values;
+
+    using KeyDefaults = KeyDefaultsT<>;
+
+    template<Keywords key>
+    inline typename KeyInfo<key>::resolved KeyValuesPtr::Resolved() const
+    {
+        const typename KeyInfo<key>::type * pSelect[2] = { &KeyInfo<key>::Field(KeyDefaults::values), KeyInfo<key>::Slot(*this) };
+        return KeyResolved<typename KeyInfo<key>::type>::Get(*pSelect[keyMask.Has(key)]);
+    }
+
+} // namespace ckwargs
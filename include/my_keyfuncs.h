@@ -68,20 +68,39 @@
 namespace kf  // rename to whatever fits your program.  Or bring it in as a class/struct into a class.
 {
 
+    // The keyword functions are constexpr (and therefore inline), so that keywords with constant values can be 
+    // built at compile-time, i.e. static constexpr auto kBorder = kf::BorderSize(10);  (see "Constant keywords" in ckwargs.h)
+    //
+    // See my_keyfuncs.cpp for more information about keyword functions.
+
     // Sets a Range of iMin to iMax values.
     // integer, or array<int,2> values may be used. 
     // 
     // This example shows using 2 forms for the Range keyword, which delivers one type to the function using the keyword.
     //
-    ckwargs::ckw Range(std::array<int,2> szRange);
-    ckwargs::ckw Range(int iMin,int iMax);
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::Range> Range(std::array<int,2> szRange)  { return ckwargs::ckwkey<ckwargs::Keywords::Range>(szRange); }
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::Range> Range(int iMin,int iMax)          { return ckwargs::ckwkey<ckwargs::Keywords::Range>({ iMin, iMax }); }
 
     // Text keyword is used to send additional text to the function, i.e. function(..parms...,Text("This is some additional text"); 
     // 
     // This example sets "<nullptr>" to the string, so we know it as input as a keyword.  Otherwise, the null can just be sent
     //
-    ckwargs::ckw Text(const char * sText)      ;
-    ckwargs::ckw BorderSize(int iSize)         ;
-    ckwargs::ckw AddBorder(bool bValue = true) ;
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::Text>       Text(const char * sText)        { return ckwargs::ckwkey<ckwargs::Keywords::Text>(sText ? sText : "<nullptr>"); }
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::BorderSize> BorderSize(int iSize)           { return ckwargs::ckwkey<ckwargs::Keywords::BorderSize>(iSize); }
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::AddBorder>  AddBorder(bool bValue = true)   { return ckwargs::ckwkey<ckwargs::Keywords::AddBorder>(bValue); }
+
+    // Palette keyword passes a 256-entry palette by reference (its type is keyref<> in my_keydefs.h), i.e. function(...parms...,Palette(szPalette))
+    //
+    // Only the address of the palette is stored, so the palette isn't copied.  It must exist until the function returns.
+    //
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::Palette>    Palette(const std::array<unsigned int,256> & szPalette) { return ckwargs::ckwkey<ckwargs::Keywords::Palette>({ &szPalette }); }
+
+    // TextExtent keyword takes the extent of the text, or a function returning it, which is only called if the function reads
+    // the keyword (its type is keylazy<> in my_keydefs.h), i.e. TextExtent(100,20) or TextExtent([&]{ return Measure(sText); })
+    //
+    constexpr ckwargs::ckwkey<ckwargs::Keywords::TextExtent> TextExtent(int iWidth,int iHeight) { return ckwargs::ckwkey<ckwargs::Keywords::TextExtent>(ckwargs::keylazy<std::array<int,2>>::Of({ iWidth, iHeight })); }
+
+    template<class F>
+    constexpr ckwargs::KeyCallable<std::array<int,2>,F,ckwargs::ckwkey<ckwargs::Keywords::TextExtent>> TextExtent(const F & fExtent)      { return ckwargs::ckwkey<ckwargs::Keywords::TextExtent>(ckwargs::keylazy<std::array<int,2>>::Of(fExtent)); }
 
 }
\ No newline at end of file
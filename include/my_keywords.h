@@ -63,6 +63,10 @@
 
 namespace kw  // rename to whatever fits your program.  Or bring it in as a class/struct into a class.
 {
+    // The keyword operators are constexpr (and therefore inline), so that keywords with constant values can be 
+    // built at compile-time, i.e. static constexpr auto kBorder = kw::BorderSize = 10;  (see "Constant keywords" in ckwargs.h)
+    //
+    // The keyword objects themselves are defined in my_keywords.cpp
 
     // Sets a Range of iMin to iMax values.
     //
@@ -70,14 +74,31 @@ namespace kw  // rename to whatever fits your program.  Or bring it in as a clas
     // probably not too useful in the keyword form -- See the kf class below to show the Range() option 
     // used with more than one value (i.e. min, max)
     //
-    extern struct __Range        { ckwargs::ckw operator =(std::array<int,2> szRange); } Range;
-    extern struct __BorderSize   { ckwargs::ckw operator =(int iSize);                 } BorderSize;
+    extern struct __Range        { constexpr ckwargs::ckwkey<ckwargs::Keywords::Range>      operator =(std::array<int,2> szRange) const { return ckwargs::ckwkey<ckwargs::Keywords::Range>(szRange);   } } Range;
+    extern struct __BorderSize   { constexpr ckwargs::ckwkey<ckwargs::Keywords::BorderSize> operator =(int iSize)                 const { return ckwargs::ckwkey<ckwargs::Keywords::BorderSize>(iSize);  } } BorderSize;
 
     // Text keyword is used to send additional text to the function, i.e. function(..parms...,Text("This is some additional text"); 
     // 
     // This example sets "<nullptr>" to the string, so we know it as input as a keyword.  Otherwise, the null can just be sent
     //
-    extern struct __Text        { ckwargs::ckw operator =(const char * sText)  ; } Text ;
-    extern struct __AddBorder   { ckwargs::ckw operator =(bool bValue)         ; } AddBorder;
+    extern struct __Text        { constexpr ckwargs::ckwkey<ckwargs::Keywords::Text>      operator =(const char * sText)  const { return ckwargs::ckwkey<ckwargs::Keywords::Text>(sText);       } } Text ;
+    extern struct __AddBorder   { constexpr ckwargs::ckwkey<ckwargs::Keywords::AddBorder> operator =(bool bValue)         const { return ckwargs::ckwkey<ckwargs::Keywords::AddBorder>(bValue);  } } AddBorder;
+
+    // Palette keyword passes a 256-entry palette by reference (its type is keyref<> in my_keydefs.h), i.e. function(...parms...,Palette = szPalette)
+    //
+    // Only the address of the palette is stored, so the palette isn't copied.  It must exist until the function returns.
+    //
+    extern struct __Palette     { constexpr ckwargs::ckwkey<ckwargs::Keywords::Palette>   operator =(const std::array<unsigned int,256> & szPalette) const { return ckwargs::ckwkey<ckwargs::Keywords::Palette>({ &szPalette }); } } Palette;
+
+    // TextExtent keyword takes the extent of the text, or a function returning it, which is only called if the function reads
+    // the keyword (its type is keylazy<> in my_keydefs.h), i.e. TextExtent = { 100, 20 } or TextExtent = [&]{ return Measure(sText); }
+    //
+    extern struct __TextExtent
+    {
+        constexpr ckwargs::ckwkey<ckwargs::Keywords::TextExtent> operator =(std::array<int,2> szExtent) const { return ckwargs::ckwkey<ckwargs::Keywords::TextExtent>(ckwargs::keylazy<std::array<int,2>>::Of(szExtent)); }
+
+        template<class F> 
+        constexpr ckwargs::KeyCallable<std::array<int,2>,F,ckwargs::ckwkey<ckwargs::Keywords::TextExtent>> operator =(const F & fExtent) const { return ckwargs::ckwkey<ckwargs::Keywords::TextExtent>(ckwargs::keylazy<std::array<int,2>>::Of(fExtent)); }
+    } TextExtent;
 
 };
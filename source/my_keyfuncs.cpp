@@ -1,4 +1,3 @@
-#define _ckwargs_inc_check_items
 #include "my_keyfuncs.h"
 
 using namespace ckwargs;        // Use are namespace locally so if we change it we only have to do it here.
@@ -9,12 +8,9 @@ using namespace ckwargs;        // Use are namespace locally so if we change it
 //
 // This file contains code for setting up function-based keywords using the example keywords in keydefs.h.
 
-// Helper Macros.  See examples below. The second Range example shows filling in the keyword value
-//                 without using any macros, showing the original form.
-
-#define SetKeyVal(_x,_value) { return ckw(Keywords::_x, [&](ckw & kwx) { kwx.keyValues._x = _value;   }); }
-#define SetKeyDirect(_x) { return ckw(Keywords::_x, [&](ckw & kwx) { kwx.keyValues._x = value;   }); }
-#define defOptEq(x) ckw __##x        :: operator
+// The keyword functions themselves are now constexpr and defined in my_keyfuncs.h, so that keywords with 
+// constant values can be built at compile-time.  This file remains for the notes below and for keyword functions
+// that can't be constexpr (i.e. ones that fill in the value from a non-constexpr function).
 
 // --------------------------------------------------
 // Named Parameter Functions (i.e. Keyword Functions)
@@ -41,29 +37,18 @@ using namespace ckwargs;        // Use are namespace locally so if we change it
 //       are easily readable.  The keyworded format makes them a little harder to read, as they names are at the end of the structure definition.
 //       This isn't an issue for the end-user, though, just when implementing the code for the keyword functions.
 //
-// Example without Helper Macros:
+// Example keyword function (as in my_keyfuncs.h):
 //
-//  ckw BorderSize(int iSize)  
-//          { return ckw(Keywords::BorderSize, [&](ckw & kwx) { kwx.keyValues.BorderSize = iSize;   }); } 
+//  constexpr ckwkey<Keywords::BorderSize> BorderSize(int iSize)  
+//          { return ckwkey<Keywords::BorderSize>(iSize); } 
 //
+// or, filling in the value from a lambda (the lambda is called directly and inlined, but the function
+// can't be constexpr, so it would be declared in my_keyfuncs.h and defined here):
+//
+//  ckwkey<Keywords::BorderSize> BorderSize(int iSize)  
+//          { return ckwkey<Keywords::BorderSize>([&](int & value) { value = iSize;   }); } 
 //
-namespace kf        // Can be namespace or class/struct.  See notes in ckwargs.h 
-{
-    ckw Range(std::array<int,2> value)  SetKeyDirect(Range)
-
-    // because of the ',' in the values, we can't use the macros:
-
-    ckw Range(int iMin,int iMax)   { return ckw(Keywords::Range, [&](auto & kwx) { kwx.keyValues.Range = std::array<int,2>{ iMin, iMax}; }); }
-
-    // Here, we can't use SetKeyDirect() because of the ternery, but can use SetKeyVal
-
-    ckw Text(const char * value)      SetKeyVal(Text , value ? value : "<nullptr>"); 
-
-    ckw BorderSize(int value)         SetKeyDirect(BorderSize); 
-    ckw AddBorder(bool value)         SetKeyDirect(AddBorder) ; 
-
-}
 
-// class/struct-based Example
+// class/struct-based Example (in my_keyfuncs.h)
 //
-// ckw kf::BorderSize(int value)         SetKeyDirect(BorderSize); 
\ No newline at end of file
+// struct kf { static constexpr ckwkey<Keywords::BorderSize> BorderSize(int value) { return ckwkey<Keywords::BorderSize>(value); } }; 
\ No newline at end of file